@@ -0,0 +1,90 @@
+// Время полного рендера страниц Display и SpinBox: float против kf::ui::Fixed
+// На ESP32 измеряется в тактах ядра, на остальных платах - в микросекундах (micros)
+
+#include <Arduino.h>
+
+#include <kf/UI.hpp>
+#include <kf/ui/Fixed.hpp>
+#include <kf/ui/TextRender.hpp>
+
+using TextUI = kf::UI<kf::ui::TextRender>;
+
+using Volts = kf::ui::Fixed<2>;
+
+// Кол-во рендеров каждой страницы
+static constexpr unsigned long renders_total{1000};
+
+kf::ui::TextRender::Buffer<4, 20> frame;
+
+float float_values[3]{3.3f, -12.75f, 1234.5f};
+
+Volts fixed_values[3]{Volts::from(3.3), Volts::from(-12.75), Volts::from(1234.5)};
+
+TextUI::Page float_display_page{"float Display"};
+TextUI::Display<float> float_display_0{float_display_page, float_values[0]};
+TextUI::Display<float> float_display_1{float_display_page, float_values[1]};
+TextUI::Display<float> float_display_2{float_display_page, float_values[2]};
+
+TextUI::Page fixed_display_page{"Fixed Display"};
+TextUI::Display<Volts> fixed_display_0{fixed_display_page, fixed_values[0]};
+TextUI::Display<Volts> fixed_display_1{fixed_display_page, fixed_values[1]};
+TextUI::Display<Volts> fixed_display_2{fixed_display_page, fixed_values[2]};
+
+TextUI::Page float_spinbox_page{"float SpinBox"};
+TextUI::SpinBox<float> float_spinbox_0{float_spinbox_page, float_values[0], 0.05f};
+TextUI::SpinBox<float> float_spinbox_1{float_spinbox_page, float_values[1], 0.05f};
+TextUI::SpinBox<float> float_spinbox_2{float_spinbox_page, float_values[2], 0.05f};
+
+TextUI::Page fixed_spinbox_page{"Fixed SpinBox"};
+TextUI::SpinBox<Volts> fixed_spinbox_0{fixed_spinbox_page, fixed_values[0], Volts::from(0.05)};
+TextUI::SpinBox<Volts> fixed_spinbox_1{fixed_spinbox_page, fixed_values[1], Volts::from(0.05)};
+TextUI::SpinBox<Volts> fixed_spinbox_2{fixed_spinbox_page, fixed_values[2], Volts::from(0.05)};
+
+#if defined(ESP32)
+static const char *const unit = " cycles";
+
+static unsigned long now() { return ESP.getCycleCount(); }
+#else
+static const char *const unit = " us";
+
+static unsigned long now() { return micros(); }
+#endif
+
+/// @brief Измерить время <code>renders_total</code> полных рендеров страницы
+void measure(TextUI::Page &page, const char *name) {
+    auto &ui = TextUI::instance();
+    ui.bindPage(page);
+
+    const auto start = now();
+
+    for (unsigned long i = 0; i < renders_total; i += 1) {
+        ui.addEvent(TextUI::Event::Update());
+        ui.poll();
+    }
+
+    const auto elapsed = now() - start;
+
+    Serial.print(name);
+    Serial.print(": ");
+    Serial.print(elapsed);
+    Serial.println(unit);
+}
+
+void setup() {
+    Serial.begin(115200);
+
+    auto &render_settings = TextUI::instance().getRenderSettings();
+    render_settings.bindBuffer(frame);
+    render_settings.on_render_finish = [](const kf::slice<const kf::u8> &) {};
+
+    Serial.print("time of ");
+    Serial.print(renders_total);
+    Serial.println(" full renders of a page with 3 widgets:");
+
+    measure(float_display_page, "Display<float>");
+    measure(fixed_display_page, "Display<Fixed<2>>");
+    measure(float_spinbox_page, "SpinBox<float>");
+    measure(fixed_spinbox_page, "SpinBox<Fixed<2>>");
+}
+
+void loop() {}
@@ -0,0 +1,69 @@
+// Отчёт о размерах встроенных виджетов для текущей платформы
+// Размер зависит от разрядности указателей и реализации kf::fn, поэтому измеряется на целевой плате
+
+#include <Arduino.h>
+
+#include <kf/UI.hpp>
+#include <kf/ui/TextRender.hpp>
+
+// Кольца используют std::atomic, которого нет в avr-gcc
+#if not defined(__AVR__)
+#include <kf/ui/LogRing.hpp>
+#include <kf/ui/SampleRing.hpp>
+#endif
+
+using TextUI = kf::UI<kf::ui::TextRender>;
+
+using Volts = kf::ui::Fixed<2>;
+
+#if not defined(__AVR__)
+using Samples = kf::ui::SampleRing<float, 64>;
+
+using Log = kf::ui::LogRing<16, 32>;
+#endif
+
+// Компактные обработчики - два указателя без динамической памяти
+static_assert(sizeof(kf::ui::Callback<void()>) == 2 * sizeof(void *), "Callback: function + context");
+static_assert(sizeof(kf::ui::Callback<void(bool)>) == 2 * sizeof(void *), "Callback: function + context");
+
+// Компактная кнопка - vptr + метка + Callback, без выравнивающих байт
+static_assert(
+    sizeof(TextUI::CompactButton) == sizeof(void *) + sizeof(kf::ui::Text) + sizeof(kf::ui::Callback<void()>),
+    "CompactButton: vptr + label + Callback");
+
+template<typename T> void report(const char *name) {
+    Serial.print(name);
+    Serial.print(": ");
+    Serial.println(static_cast<unsigned>(sizeof(T)));
+}
+
+void setup() {
+    Serial.begin(115200);
+
+    Serial.println("sizeof:");
+
+    report<void *>("void *");
+    report<kf::ui::Text>("kf::ui::Text");
+    report<kf::fn<void()>>("kf::fn<void()>");
+    report<kf::ui::Callback<void()>>("kf::ui::Callback<void()>");
+
+    report<TextUI::Page>("Page");
+    report<TextUI::Button>("Button");
+    report<TextUI::CompactButton>("CompactButton");
+    report<TextUI::CheckBox>("CheckBox");
+    report<TextUI::CompactCheckBox>("CompactCheckBox");
+    report<TextUI::Action>("Action");
+    report<TextUI::CompactAction>("CompactAction");
+    report<TextUI::ComboBox<int, 3>>("ComboBox<int, 3>");
+    report<TextUI::Display<float>>("Display<float>");
+    report<TextUI::SpinBox<float>>("SpinBox<float>");
+    report<TextUI::SpinBox<Volts>>("SpinBox<Fixed<2>>");
+    report<TextUI::Labeled<TextUI::Display<float>>>("Labeled<Display<float>>");
+    report<TextUI::LazyPage<TextUI::Page>>("LazyPage<Page>");
+#if not defined(__AVR__)
+    report<TextUI::Plot<Samples>>("Plot<SampleRing<float, 64>>");
+    report<TextUI::Console<Log>>("Console<LogRing<16, 32>>");
+#endif
+}
+
+void loop() {}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <new>
+
 #include <kf/algorithm.hpp>
 #include <kf/attributes.hpp>
 #include <kf/fn.hpp>
@@ -8,12 +10,17 @@
 
 #include <kf/array.hpp>
 #include <kf/queue.hpp>
+#include <kf/slice.hpp>
 #include <kf/vector.hpp>
 
 #include <kf/aliases.hpp>
 #include <kf/tools/meta/Singleton.hpp>
 
+#include "kf/ui/Callback.hpp"
 #include "kf/ui/Event.hpp"
+#include "kf/ui/Fixed.hpp"
+#include "kf/ui/Snapshot.hpp"
+#include "kf/ui/Text.hpp"
 
 namespace kf {
 
@@ -30,6 +37,8 @@ template<typename R> struct UI final : tools::Singleton<UI<R>> {
 
     struct Page;
 
+    struct LazyLink;
+
     /// @brief Виджет
     struct Widget {
 
@@ -55,6 +64,26 @@ template<typename R> struct UI final : tools::Singleton<UI<R>> {
         /// @returns false - Перерисовка не требуется
         virtual bool onChange(int direction) { return false; }
 
+        /// @brief Шаг фоновой работы (См. <code>UI::bindTask</code>)
+        /// @returns true - Нужна перерисовка
+        /// @returns false - Перерисовка не требуется
+        virtual bool onStep() { return false; }
+
+        /// @brief Подпись для перехода по первым буквам (См. <code>Page::buildIndex</code>)
+        /// @returns Пустая строка - Виджет не участвует в переходе
+        virtual ui::Text caption() const { return ""; }
+
+        /// @brief Размер состояния виджета в снимке (См. <code>UI::saveState</code>)
+        virtual usize stateSize() const { return 0; }
+
+        /// @brief Записать состояние в снимок
+        /// @param out Память размером <code>stateSize()</code>
+        virtual void saveState(u8 *out) const {}
+
+        /// @brief Восстановить состояние из снимка
+        /// @param in Память размером <code>stateSize()</code>
+        virtual void restoreState(const u8 *in) {}
+
         /// @brief Внешняя отрисовка виджета
         /// @param render Система отрисовки
         /// @param focused Виджет в фокусе курсора
@@ -71,6 +100,8 @@ template<typename R> struct UI final : tools::Singleton<UI<R>> {
 
     /// @brief Страница, содержит виджеты и обладает заголовком.
     struct Page {
+        friend struct LazyLink;
+        friend struct UI;
 
     private:
         /// @brief Специальный виджет для создания кнопки перехода на страницу
@@ -95,23 +126,49 @@ template<typename R> struct UI final : tools::Singleton<UI<R>> {
                 render.arrow();
                 render.string(target.title);
             }
+
+            ui::Text caption() const override { return target.title; }
         };
 
+        /// @brief Наибольшая длина набираемого префикса перехода
+        static constexpr u8 seek_prefix_max{4};
+
         /// @brief Виджеты данной страницы
         vector<Widget *> widgets{};// todo Widget refs
 
         /// @brief Заголовок страницы.
-        const char *title;
+        ui::Text title;
 
         /// @brief Курсор
         /// @details Индекс активного виджета
         usize cursor{0};
 
+        /// @brief Первый виджет окна последнего полного рендера
+        usize window_start{0};
+
+        /// @brief Кол-во виджетов в окне последнего полного рендера
+        usize window_size{0};
+
+        /// @brief Курсор на момент последнего рендера
+        usize rendered_cursor{0};
+
+        /// @brief Последнее событие только сместило курсор - достаточно перерисовать две строки
+        bool rows_pending{false};
+
+        /// @brief Индексы виджетов, упорядоченные по меткам
+        kf::slice<u16> label_index{};
+
+        /// @brief Набранный префикс перехода (Строчные буквы)
+        char seek_prefix[seek_prefix_max]{};
+
+        /// @brief Длина набранного префикса
+        u8 seek_length{0};
+
         /// @brief Виджет перехода к данной странице
         PageSetter to_this{*this};
 
     public:
-        explicit Page(const char *title) :
+        explicit Page(ui::Text title) :
             title{title} {}
 
         /// @brief Добавить виджет в данную страницу
@@ -128,20 +185,92 @@ template<typename R> struct UI final : tools::Singleton<UI<R>> {
             other.addWidget(this->to_this);
         }
 
+        /// @brief Связывание с ленивой страницей
+        /// @details Добавляет переход к ленивой странице. Обратный переход добавляется при её создании
+        /// @param other Ленивая страница
+        void link(LazyLink &other) {
+            this->addWidget(other);
+        }
+
         /// @brief Отобразить страницу
         /// @param render Система отрисовки
         void render(RenderImpl &render) {
             render.title(title);
 
             const auto available = render.widgetsAvailable();
-            const auto start = (totalWidgets() > available) ? min(cursor, totalWidgets() - available) : 0;
+            const auto start = windowStart(available);
             const auto end = min(start + available, totalWidgets());
 
+            UI &ui = UI::instance();
+            ui.clearTapRows(*this);
+
             for (auto i = start; i < end; i += 1) {
+                const auto row_first = render.cursorRow();
+
                 render.widgetBegin(i);
                 widgets[i]->render(render, i == cursor);
                 render.widgetEnd();
+
+                ui.mapTapRows(row_first, render.cursorRow(), i - start);
             }
+
+            window_start = start;
+            window_size = available;
+            rendered_cursor = cursor;
+            rows_pending = false;
+        }
+
+        /// @brief Перерисовать только строки прежнего и нового положения курсора
+        /// @details Возможно, если последнее событие только сместило курсор в пределах окна виджетов.
+        /// Окно сдвигается лишь при выходе курсора за его край (См. <code>windowStart</code>), тогда нужен полный рендер
+        /// @param render Система отрисовки
+        /// @return true Строки перерисованы
+        /// @return false Требуется полный рендер
+        bool renderRows(RenderImpl &render) {
+            if (not rows_pending or not render.rowsRedrawSupported()) {
+                return false;
+            }
+
+            rows_pending = false;
+
+            if (windowStart(window_size) != window_start) {
+                return false;
+            }
+
+            render.rowsBegin();
+            renderRow(render, rendered_cursor);
+            renderRow(render, cursor);
+            render.rowsEnd();
+
+            rendered_cursor = cursor;
+            return true;
+        }
+
+        /// @brief Построить упорядоченный индекс меток для перехода по первым буквам (<code>Event::PageSeek</code>)
+        /// @details Вызывается один раз после добавления всех виджетов. Переход по индексу - двоичный поиск,
+        /// без индекса выполняется перебор виджетов. Регистр букв не учитывается
+        /// @param memory Память индекса, не менее <code>totalWidgets()</code> элементов
+        /// @returns false - Недостаточно памяти, индекс не построен
+        bool buildIndex(kf::slice<u16> memory) {
+            label_index = {};
+
+            if (nullptr == memory.data() or memory.size() < totalWidgets()) {
+                return false;
+            }
+
+            u16 *entries = memory.data();
+            usize total{0};
+
+            for (usize i = 0; i < totalWidgets(); i += 1) {
+                if (not labelEmpty(widgets[i]->caption())) {
+                    entries[total] = static_cast<u16>(i);
+                    total += 1;
+                }
+            }
+
+            sortIndex(entries, total);
+            label_index = {entries, total};
+            return true;
         }
 
         /// @brief Отреагировать на событие
@@ -149,6 +278,12 @@ template<typename R> struct UI final : tools::Singleton<UI<R>> {
         /// @return true Рендер требуется
         /// @return false Рендер не требуется
         bool onEvent(Event event) {
+            rows_pending = false;
+
+            if (event.type() != Event::Type::PageSeek) {
+                seek_length = 0;
+            }
+
             switch (event.type()) {
                 case Event::Type::None: {
                     return false;
@@ -157,7 +292,36 @@ template<typename R> struct UI final : tools::Singleton<UI<R>> {
                     return true;
                 }
                 case Event::Type::PageCursorMove: {
-                    return moveCursor(event.value());
+                    rows_pending = moveCursor(event.value());
+                    return rows_pending;
+                }
+                case Event::Type::PageScroll: {
+                    // Окно и курсор сдвигаются вместе: курсор сохраняет строку экрана
+                    const auto delta = event.value() * static_cast<isize>(max(window_size, usize(1)));
+                    const bool window_moved = scrollWindow(delta);
+                    return moveCursor(delta) or window_moved;
+                }
+                case Event::Type::PageSeek: {
+                    rows_pending = seek(static_cast<char>('a' + event.code()));
+                    return rows_pending;
+                }
+                case Event::Type::PointerTap: {
+                    usize offset{0};
+
+                    if (not UI::instance().widgetAtRow(*this, event.code(), offset)) {
+                        return false;
+                    }
+
+                    const auto index = window_start + offset;
+
+                    if (index >= totalWidgets()) {
+                        return false;
+                    }
+
+                    // Фокус устанавливается до клика: клик может уничтожить страницу (Переход с ленивой страницы)
+                    cursor = index;
+                    (void) widgets[index]->onClick();
+                    return true;
                 }
                 case Event::Type::WidgetClick: {
                     if (totalWidgets() > 0) {
@@ -177,9 +341,97 @@ template<typename R> struct UI final : tools::Singleton<UI<R>> {
         kf_nodiscard inline usize totalWidgets() const { return static_cast<int>(widgets.size()); }
 
     private:
+        /// @brief Первый виджет окна, содержащего курсор
+        /// @details Окно неподвижно, пока курсор остаётся в нём, и сдвигается ровно настолько, чтобы курсор снова был виден
+        /// @param available Кол-во виджетов в окне
+        kf_nodiscard usize windowStart(usize available) const {
+            if (totalWidgets() <= available) {
+                return 0;
+            }
+
+            auto start = window_start;
+
+            if (cursor < start) {
+                start = cursor;
+            } else if (cursor - start >= available) {
+                start = cursor + 1 - max(available, usize(1));
+            }
+
+            return min(start, totalWidgets() - available);
+        }
+
+        /// @brief Сдвинуть окно виджетов
+        /// @return true Окно сдвинулось
+        bool scrollWindow(isize delta) {
+            const auto last_start = window_start;
+            const auto start_max = static_cast<isize>(totalWidgets() > window_size ? totalWidgets() - window_size : 0);
+
+            window_start = static_cast<usize>(min(max(static_cast<isize>(window_start) + delta, isize(0)), start_max));
+            return last_start != window_start;
+        }
+
+        /// @brief Перерисовать строку виджета
+        void renderRow(RenderImpl &render, usize index) {
+            render.rowBegin(index - window_start, index);
+            widgets[index]->render(render, index == cursor);
+            render.rowEnd();
+        }
+
         /// @brief Максимальная позиция курсора
         kf_nodiscard inline usize cursorPositionMax() const { return totalWidgets() - 1; }
 
+        /// @brief Размер состояния страницы в снимке: курсор и состояния виджетов
+        kf_nodiscard usize stateSize() const {
+            usize size{sizeof(u16)};
+
+            for (usize i = 0; i < totalWidgets(); i += 1) {
+                size += widgets[i]->stateSize();
+            }
+
+            return size;
+        }
+
+        /// @brief Дополнить отпечаток раскладки снимка страницей
+        kf_nodiscard u16 layoutHash(u16 hash) const {
+            hash = static_cast<u16>(hash * 31 + totalWidgets());
+
+            for (usize i = 0; i < totalWidgets(); i += 1) {
+                hash = static_cast<u16>(hash * 31 + widgets[i]->stateSize());
+            }
+
+            return hash;
+        }
+
+        /// @brief Записать состояние страницы в снимок
+        void saveState(u8 *out) const {
+            ui::snapshotWrite(out, static_cast<u16>(cursor));
+            out += sizeof(u16);
+
+            for (usize i = 0; i < totalWidgets(); i += 1) {
+                widgets[i]->saveState(out);
+                out += widgets[i]->stateSize();
+            }
+        }
+
+        /// @brief Восстановить состояние страницы из снимка
+        void restoreState(const u8 *in) {
+            const auto saved_cursor = ui::snapshotRead<u16>(in);
+            in += sizeof(u16);
+
+            if (saved_cursor < totalWidgets()) {
+                cursor = saved_cursor;
+            }
+
+            for (usize i = 0; i < totalWidgets(); i += 1) {
+                widgets[i]->restoreState(in);
+                in += widgets[i]->stateSize();
+            }
+
+            // Окно прошлого рендера не соответствует восстановленному курсору
+            rows_pending = false;
+            seek_length = 0;
+        }
+
         /// @brief Сместить курсор на странице
         /// @param delta Величина смещения в индексах
         /// @return true Нужна перерисовка, Курсор установлен в новую позицию
@@ -191,6 +443,162 @@ template<typename R> struct UI final : tools::Singleton<UI<R>> {
             cursor = min(cursor, cursorPositionMax());
             return last_cursor != cursor;
         }
+
+        /// @brief Дополнить префикс буквой и перейти к первому подходящему виджету
+        /// @details Если дополненный префикс не найден, поиск начинается заново с этой буквы
+        /// @return true Курсор изменил позицию
+        kf_nodiscard bool seek(char letter) {
+            if (totalWidgets() == 0) {
+                return false;
+            }
+
+            if (seek_length == seek_prefix_max) {
+                seek_length = 0;
+            }
+
+            seek_prefix[seek_length] = letter;
+            seek_length += 1;
+
+            usize found{0};
+
+            if (not findPrefix(found)) {
+                seek_prefix[0] = letter;
+                seek_length = 1;
+
+                if (not findPrefix(found)) {
+                    seek_length = 0;
+                    return false;
+                }
+            }
+
+            const auto last_cursor = cursor;
+            cursor = found;
+            return last_cursor != cursor;
+        }
+
+        /// @brief Найти первый виджет, метка которого начинается с набранного префикса
+        /// @details С индексом и без него выбирается первая по алфавиту подходящая метка,
+        /// при равных метках - первый виджет в порядке страницы (Порядок <code>labelLess</code>)
+        kf_nodiscard bool findPrefix(usize &found) const {
+            if (nullptr == label_index.data()) {
+                bool matched{false};
+
+                for (usize i = 0; i < totalWidgets(); i += 1) {
+                    if (comparePrefix(widgets[i]->caption()) != 0) {
+                        continue;
+                    }
+
+                    if (not matched or labelLess(static_cast<u16>(i), static_cast<u16>(found))) {
+                        found = i;
+                        matched = true;
+                    }
+                }
+
+                return matched;
+            }
+
+            usize low{0}, high{label_index.size()};
+
+            while (low < high) {
+                const auto middle = low + (high - low) / 2;
+
+                if (comparePrefix(widgets[label_index.data()[middle]]->caption()) < 0) {
+                    low = middle + 1;
+                } else {
+                    high = middle;
+                }
+            }
+
+            if (low == label_index.size() or comparePrefix(widgets[label_index.data()[low]]->caption()) != 0) {
+                return false;
+            }
+
+            found = label_index.data()[low];
+            return true;
+        }
+
+        /// @brief Сравнить начало метки с набранным префиксом
+        /// @return 0 - метка начинается с префикса, иначе знак сравнения метки с префиксом
+        kf_nodiscard int comparePrefix(const ui::Text &label) const {
+            if (labelEmpty(label)) {
+                return -1;
+            }
+
+            for (u8 i = 0; i < seek_length; i += 1) {
+                const u8 c = lower(label[i]);
+                const auto p = static_cast<u8>(seek_prefix[i]);
+
+                if (c != p) {
+                    return c < p ? -1 : 1;
+                }
+            }
+
+            return 0;
+        }
+
+        /// @brief Метка виджета a упорядочена раньше метки виджета b
+        kf_nodiscard bool labelLess(u16 a, u16 b) const {
+            const ui::Text label_a = widgets[a]->caption();
+            const ui::Text label_b = widgets[b]->caption();
+
+            for (usize i = 0;; i += 1) {
+                const u8 c_a = lower(label_a[i]);
+                const u8 c_b = lower(label_b[i]);
+
+                if (c_a != c_b) {
+                    return c_a < c_b;
+                }
+
+                if (c_a == 0) {
+                    return a < b;
+                }
+            }
+        }
+
+        /// @brief Упорядочить индекс (Пирамидальная сортировка, без дополнительной памяти)
+        void sortIndex(u16 *entries, usize total) const {
+            for (usize i = total / 2; i > 0; i -= 1) {
+                siftDown(entries, i - 1, total);
+            }
+
+            for (usize end = total; end > 1; end -= 1) {
+                const u16 top = entries[0];
+                entries[0] = entries[end - 1];
+                entries[end - 1] = top;
+                siftDown(entries, 0, end - 1);
+            }
+        }
+
+        void siftDown(u16 *entries, usize root, usize end) const {
+            while (true) {
+                auto child = root * 2 + 1;
+
+                if (child >= end) {
+                    return;
+                }
+
+                if (child + 1 < end and labelLess(entries[child], entries[child + 1])) {
+                    child += 1;
+                }
+
+                if (not labelLess(entries[root], entries[child])) {
+                    return;
+                }
+
+                const u16 swapped = entries[root];
+                entries[root] = entries[child];
+                entries[child] = swapped;
+                root = child;
+            }
+        }
+
+        kf_nodiscard static bool labelEmpty(const ui::Text &label) {
+            return nullptr == label.data() or label[0] == '\x00';
+        }
+
+        kf_nodiscard static u8 lower(char c) {
+            return static_cast<u8>((c >= 'A' and c <= 'Z') ? c - 'A' + 'a' : c);
+        }
     };
 
 private:
@@ -200,6 +608,41 @@ private:
     /// @brief Активная страница
     Page *active_page{nullptr};
 
+    /// @brief Виджет, выполняющий фоновую работу
+    Widget *task{nullptr};
+
+    /// @brief Область памяти ленивых страниц
+    kf::slice<u8> page_arena{};
+
+    /// @brief Созданная ленивая страница
+    Page *lazy_page{nullptr};
+
+    /// @brief Переход, создавший ленивую страницу
+    LazyLink *lazy_link{nullptr};
+
+    /// @brief Наибольшее кол-во строк экрана, доступных для касания (См. <code>Event::PointerTap</code>)
+    static constexpr usize tap_rows_max{32};
+
+    /// @brief Виджеты строк экрана последнего полного рендера: смещение в окне виджетов + 1, 0 - нет виджета
+    array<u8, tap_rows_max> tap_rows{};
+
+    /// @brief Страница последнего полного рендера
+    const Page *rendered_page{nullptr};
+
+    /// @brief Заголовок снимка состояния
+    struct SnapshotHeader {
+        u16 magic;
+        u16 layout;
+        u16 size;
+        u8 active;
+        u8 checksum;
+    };
+
+    static constexpr u16 snapshot_magic{0x4B53};
+
+    /// @brief Активная страница отсутствует в наборе сохраняемых
+    static constexpr u8 snapshot_page_none{0xFF};
+
     /// @brief Система отображения
     RenderImpl render_system{};
 
@@ -211,25 +654,220 @@ public:
 
     /// @brief Установить активную страницу
     void bindPage(Page &page) {
+        if (nullptr != lazy_page and lazy_page != &page) {
+            releaseLazyPage();
+        }
+
         active_page = &page;
     }
 
+    /// @brief Установить область памяти для ленивых страниц
+    /// @details Размер области - наибольший из <code>LazyPage::arenaSize</code> используемых страниц
+    void bindPageArena(kf::slice<u8> memory) {
+        page_arena = memory;
+    }
+
+    /// @brief Страница является активной
+    kf_nodiscard bool isActive(const Page &page) const {
+        return active_page == &page;
+    }
+
+    /// @brief Установить виджет, выполняющий фоновую работу
+    /// @details Шаг работы выполняется при каждом вызове <code>poll</code>
+    /// @param widget Виджет или nullptr для завершения работы
+    void bindTask(Widget *widget) {
+        task = widget;
+    }
+
+    /// @brief Выполняется фоновая работа
+    kf_nodiscard bool isTaskRunning() const {
+        return nullptr != task;
+    }
+
     /// @brief Добавить событие в очередь
     void addEvent(Event event) {
         events.push(event);
     }
 
-    /// @brief Прокрутка входящих событий. Выполняет рендер при необходимости
+    /// @brief Размер снимка состояния для набора страниц
+    kf_nodiscard static usize stateSize(kf::slice<Page *const> pages) {
+        usize size{sizeof(SnapshotHeader)};
+
+        for (usize i = 0; i < pages.size(); i += 1) {
+            size += pages.data()[i]->stateSize();
+        }
+
+        return size;
+    }
+
+    /// @brief Сохранить снимок состояния интерфейса
+    /// @details Снимок содержит активную страницу, курсоры страниц и состояния виджетов
+    /// (режим и шаг <code>SpinBox</code>, курсор <code>ComboBox</code>).
+    /// Снимок можно хранить в памяти, сохраняемой в глубоком сне, и восстановить одним вызовом <code>restoreState</code>.
+    /// Ленивые страницы в снимок не входят
+    /// @param memory Память снимка, не менее <code>stateSize(pages)</code>
+    /// @param pages Сохраняемые страницы. Порядок определяет идентификаторы страниц и должен совпадать при восстановлении
+    /// @returns Размер снимка, 0 - недостаточно памяти
+    usize saveState(kf::slice<u8> memory, kf::slice<Page *const> pages) const {
+        const auto size = stateSize(pages);
+
+        if (nullptr == memory.data() or memory.size() < size or size > 0xFFFF or pages.size() >= snapshot_page_none) {
+            return 0;
+        }
+
+        u8 *body = memory.data() + sizeof(SnapshotHeader);
+        u8 *out = body;
+
+        SnapshotHeader header{snapshot_magic, layoutHash(pages), static_cast<u16>(size), snapshot_page_none, 0};
+
+        for (usize i = 0; i < pages.size(); i += 1) {
+            const Page &page = *pages.data()[i];
+
+            if (&page == active_page) {
+                header.active = static_cast<u8>(i);
+            }
+
+            page.saveState(out);
+            out += page.stateSize();
+        }
+
+        header.checksum = ui::snapshotChecksum(body, size - sizeof(SnapshotHeader));
+        ui::snapshotWrite(memory.data(), header);
+        return size;
+    }
+
+    /// @brief Восстановить состояние интерфейса из снимка
+    /// @details Вызывается после создания и связывания страниц. Снимок другой раскладки или повреждённый не применяется.
+    /// Восстановленный кадр отображается при следующем <code>poll</code>
+    /// @param snapshot Снимок (См. <code>saveState</code>)
+    /// @param pages Страницы в порядке сохранения
+    /// @returns false - Снимок не соответствует страницам или повреждён
+    bool restoreState(kf::slice<const u8> snapshot, kf::slice<Page *const> pages) {
+        const auto size = stateSize(pages);
+
+        if (nullptr == snapshot.data() or snapshot.size() < size) {
+            return false;
+        }
+
+        const auto header = ui::snapshotRead<SnapshotHeader>(snapshot.data());
+        const u8 *body = snapshot.data() + sizeof(SnapshotHeader);
+
+        if (header.magic != snapshot_magic or header.size != size or header.layout != layoutHash(pages)) {
+            return false;
+        }
+
+        if (header.checksum != ui::snapshotChecksum(body, size - sizeof(SnapshotHeader))) {
+            return false;
+        }
+
+        for (usize i = 0; i < pages.size(); i += 1) {
+            Page &page = *pages.data()[i];
+            page.restoreState(body);
+            body += page.stateSize();
+        }
+
+        if (header.active < pages.size()) {
+            bindPage(*pages.data()[header.active]);
+        }
+
+        addEvent(Event::Update());
+        return true;
+    }
+
+private:
+    /// @brief Уничтожить созданную ленивую страницу
+    void releaseLazyPage() {
+        const auto arena_begin = reinterpret_cast<usize>(page_arena.data());
+        const auto task_address = reinterpret_cast<usize>(task);
+
+        // Фоновая работа виджета уничтожаемой страницы прекращается
+        if (task_address >= arena_begin and task_address < arena_begin + page_arena.size()) {
+            task = nullptr;
+        }
+
+        Page *released = lazy_page;
+        lazy_page = nullptr;
+
+        if (rendered_page == released) {
+            rendered_page = nullptr;
+        }
+
+        lazy_link->destroy(*released);
+        lazy_link = nullptr;
+    }
+
+    /// @brief Отпечаток раскладки снимка: кол-во виджетов страниц и размеры их состояний
+    kf_nodiscard static u16 layoutHash(kf::slice<Page *const> pages) {
+        auto hash = static_cast<u16>(pages.size());
+
+        for (usize i = 0; i < pages.size(); i += 1) {
+            hash = pages.data()[i]->layoutHash(hash);
+        }
+
+        return hash;
+    }
+
+    /// @brief Начать заполнение карты касаний страницы
+    void clearTapRows(const Page &page) {
+        rendered_page = &page;
+
+        for (auto &row: tap_rows) {
+            row = 0;
+        }
+    }
+
+    /// @brief Отметить строки экрана, занятые виджетом
+    /// @param row_first Первая строка виджета
+    /// @param row_end Строка после виджета
+    /// @param offset Смещение виджета в окне
+    void mapTapRows(usize row_first, usize row_end, usize offset) {
+        if (row_first == RenderImpl::row_unknown or offset >= 0xFF) {
+            return;
+        }
+
+        for (auto row = row_first; row < row_end and row < tap_rows_max; row += 1) {
+            tap_rows[row] = static_cast<u8>(offset + 1);
+        }
+    }
+
+    /// @brief Виджет под указателем по карте последнего полного рендера
+    /// @param page Страница, получившая касание
+    /// @param row Строка экрана
+    /// @param offset Смещение виджета в окне
+    /// @returns false - В строке нет виджета
+    kf_nodiscard bool widgetAtRow(const Page &page, u8 row, usize &offset) const {
+        if (&page != rendered_page or row >= tap_rows_max or tap_rows[row] == 0) {
+            return false;
+        }
+
+        offset = tap_rows[row] - 1;
+        return true;
+    }
+
+public:
+    /// @brief Прокрутка входящих событий и шаг фоновой работы. Выполняет рендер при необходимости
     void poll() {
         // mostly time active page is not null, so null-check is after queue.
-        if (events.empty() or nullptr == active_page) {
+        if ((events.empty() and nullptr == task) or nullptr == active_page) {
             return;
         }
 
-        const bool render_required = active_page->onEvent(events.front());
-        events.pop();
+        bool render_required{false};
+
+        if (not events.empty()) {
+            render_required = active_page->onEvent(events.front());
+            events.pop();
+        }
 
-        if (not render_required) {
+        const bool task_changed = nullptr != task and task->onStep();
+
+        if (not render_required and not task_changed) {
+            return;
+        }
+
+        // Фоновая работа могла изменить любую строку страницы.
+        // Строки перерисовываются только поверх кадра той же страницы (Страница могла смениться через bindPage)
+        if (not task_changed and active_page == rendered_page and active_page->renderRows(render_system)) {
             return;
         }
 
@@ -242,22 +880,23 @@ public:
     // built-in widgets
 
     /// @brief Кнопка - Виджет, реагирующий на клик
-    struct Button final : Widget {
+    /// @tparam H Тип обработчика клика (<code>kf::fn</code> или компактный <code>kf::ui::Callback</code>)
+    template<typename H = fn<void()>> struct BasicButton final : Widget {
 
         /// @brief Обработчик клика
-        using ClickHandler = fn<void()>;
+        using ClickHandler = H;
 
     private:
         /// @brief Метка кнопки
-        const char *label;
+        ui::Text label;
 
         /// @brief Внешний обработчик клика
         ClickHandler on_click;
 
     public:
-        explicit Button(
+        explicit BasicButton(
             Page &root,
-            const char *label,
+            ui::Text label,
             ClickHandler on_click) :
             Widget{root},
             label{label},
@@ -276,29 +915,43 @@ public:
             render.string(label);
             render.blockEnd();
         }
+
+        ui::Text caption() const override { return label; }
     };
 
+    /// @brief Кнопка с обработчиком <code>kf::fn</code>
+    using Button = BasicButton<>;
+
+    /// @brief Кнопка с компактным обработчиком (Указатель на функцию и контекст)
+    using CompactButton = BasicButton<ui::Callback<void()>>;
+
     /// @brief Чек-Бокс - Ввод булевого значения
-    struct CheckBox final : Widget {
+    /// @details Может быть связан с переменной: состояние согласуется со значением, изменённым извне
+    /// (Например, загруженным из хранилища)
+    /// @tparam H Тип обработчика изменения (<code>kf::fn</code> или компактный <code>kf::ui::Callback</code>)
+    template<typename H = fn<void(bool)>> struct BasicCheckBox final : Widget {
 
         /// @brief Тип внешнего обработчика изменения
-        using ChangeHandler = fn<void(bool)>;
+        using ChangeHandler = H;
 
     private:
         /// @brief Обработчик изменения
         ChangeHandler on_change;
 
+        /// @brief Связанная переменная (nullptr - состояние хранится только в виджете)
+        bool *bound{nullptr};
+
         /// @brief Состояние
-        bool state;
+        mutable bool state;
 
     public:
-        explicit CheckBox(
+        explicit BasicCheckBox(
             ChangeHandler change_handler,
             bool default_state = false) :
             on_change{move(change_handler)},
             state{default_state} {}
 
-        explicit CheckBox(
+        explicit BasicCheckBox(
             Page &root,
             ChangeHandler change_handler,
             bool default_state = false) :
@@ -306,7 +959,24 @@ public:
             on_change{move(change_handler)},
             state{default_state} {}
 
+        explicit BasicCheckBox(
+            bool &value,
+            ChangeHandler change_handler = nullptr) :
+            on_change{move(change_handler)},
+            bound{&value},
+            state{value} {}
+
+        explicit BasicCheckBox(
+            Page &root,
+            bool &value,
+            ChangeHandler change_handler = nullptr) :
+            Widget{root},
+            on_change{move(change_handler)},
+            bound{&value},
+            state{value} {}
+
         bool onClick() override {
+            syncState();
             setState(not state);
             return true;
         }
@@ -317,20 +987,153 @@ public:
         }
 
         void doRender(RenderImpl &render) const override {
+            syncState();
             render.string(state ? "[ 1 ]==" : "--[ 0 ]");
         }
 
     private:
+        /// @brief Согласовать состояние со связанной переменной
+        void syncState() const {
+            if (nullptr != bound) {
+                state = *bound;
+            }
+        }
+
         void setState(bool new_state) {
             state = new_state;
 
+            if (nullptr != bound) {
+                *bound = new_state;
+            }
+
             if (on_change) {
                 on_change(state);
             }
         }
     };
 
+    /// @brief Чек-Бокс с обработчиком <code>kf::fn</code>
+    using CheckBox = BasicCheckBox<>;
+
+    /// @brief Чек-Бокс с компактным обработчиком (Указатель на функцию и контекст)
+    using CompactCheckBox = BasicCheckBox<ui::Callback<void(bool)>>;
+
+    /// @brief Состояние действия
+    enum class ActionState : unsigned char {
+        /// @brief Не запускалось
+        Idle,
+
+        /// @brief Выполняется
+        Running,
+
+        /// @brief Завершено успешно
+        Done,
+
+        /// @brief Завершено с ошибкой
+        Failed
+    };
+
+    /// @brief Действие - Кнопка, выполняющая длительную работу по шагам
+    /// @details Клик запускает работу, далее <code>UI::poll</code> вызывает шаг, не блокируя обработку событий и рендер.
+    /// Шаг обновляет прогресс (0..100) и возвращает состояние: <code>Running</code> - продолжить, иное - завершить
+    /// @tparam H Тип обработчика шага (<code>kf::fn</code> или компактный <code>kf::ui::Callback</code>)
+    template<typename H = fn<ActionState(u8 &)>> struct BasicAction final : Widget {
+
+        /// @brief Обработчик шага
+        using StepHandler = H;
+
+    private:
+        /// @brief Страница действия
+        const Page &root;
+
+        /// @brief Метка действия
+        ui::Text label;
+
+        /// @brief Шаг работы
+        StepHandler on_step;
+
+        /// @brief Состояние
+        ActionState state{ActionState::Idle};
+
+        /// @brief Прогресс выполнения (0..100)
+        u8 progress{0};
+
+    public:
+        explicit BasicAction(
+            Page &root,
+            ui::Text label,
+            StepHandler on_step) :
+            Widget{root},
+            root{root},
+            label{label},
+            on_step{move(on_step)} {}
+
+        bool onClick() override {
+            if (not on_step or UI::instance().isTaskRunning()) {
+                return false;
+            }
+
+            state = ActionState::Running;
+            progress = 0;
+            UI::instance().bindTask(this);
+            return true;
+        }
+
+        bool onStep() override {
+            const auto last_progress = progress;
+
+            state = on_step(progress);
+
+            if (state != ActionState::Running) {
+                UI::instance().bindTask(nullptr);
+            } else if (last_progress == progress) {
+                return false;
+            }
+
+            return UI::instance().isActive(root);
+        }
+
+        void doRender(RenderImpl &render) const override {
+            render.blockBegin();
+            render.string(label);
+
+            switch (state) {
+                case ActionState::Idle: {
+                    break;
+                }
+                case ActionState::Running: {
+                    render.colon();
+                    render.number(static_cast<i32>(progress));
+                    render.string("%");
+                    break;
+                }
+                case ActionState::Done: {
+                    render.colon();
+                    render.string("ok");
+                    break;
+                }
+                case ActionState::Failed: {
+                    render.colon();
+                    render.string("fail");
+                    break;
+                }
+            }
+
+            render.blockEnd();
+        }
+
+        ui::Text caption() const override { return label; }
+    };
+
+    /// @brief Действие с обработчиком <code>kf::fn</code>
+    using Action = BasicAction<>;
+
+    /// @brief Действие с компактным обработчиком (Указатель на функцию и контекст)
+    using CompactAction = BasicAction<ui::Callback<ActionState(u8 &)>>;
+
     /// @brief ComboBox - выбор из списка значений
+    /// @details Выбранный элемент следует за изменяемым значением, поэтому в снимок состояния не входит:
+    /// значение сохраняет приложение (например, <code>kf::ui::Persistence</code>)
     /// @tparam T Тип выбираемых значений
     /// @tparam N Кол-во выбираемых значений
     template<typename T, usize N> struct ComboBox final : Widget {
@@ -343,7 +1146,7 @@ public:
         struct Item {
 
             /// @brief Наименование элемента
-            const char *key;
+            ui::Text key;
 
             /// @brief Значение
             T value;
@@ -360,7 +1163,7 @@ public:
         T &value;
 
         /// @brief Выбранное значение
-        int cursor{0};
+        mutable int cursor{0};
 
     public:
         explicit ComboBox(
@@ -378,6 +1181,7 @@ public:
             value{val} {}
 
         bool onChange(int direction) override {
+            syncCursor();
             moveCursor(direction);
 
             value = items[cursor].value;
@@ -386,12 +1190,28 @@ public:
         }
 
         void doRender(RenderImpl &render) const override {
+            syncCursor();
+
             render.variableBegin();
             render.string(items[cursor].key);
             render.variableEnd();
         }
 
     private:
+        /// @brief Согласовать курсор со значением, изменённым извне (Например, загруженным из хранилища)
+        void syncCursor() const {
+            if (items[cursor].value == value) {
+                return;
+            }
+
+            for (usize i = 0; i < N; i += 1) {
+                if (items[i].value == value) {
+                    cursor = static_cast<int>(i);
+                    return;
+                }
+            }
+        }
+
         /// @brief Сместить курсор
         /// @param delta смещение
         void moveCursor(int delta) {
@@ -402,6 +1222,7 @@ public:
     };
 
     /// @brief Отображает значение
+    /// @tparam T Тип значения: арифметический или <code>kf::ui::Fixed</code>
     template<typename T> struct Display final : Widget {
 
     private:
@@ -428,6 +1249,101 @@ public:
         }
     };
 
+    /// @brief График - Отображает последние отсчёты кольца столбцами после метки
+    /// @details Масштаб - от наименьшего до наибольшего из хранимых отсчётов, отрисовка - O(ширина графика).
+    /// Если система рендера не поддерживает графики, отображается последний отсчёт.
+    /// Кольцо - параметр шаблона, как у <code>Console</code>
+    /// @tparam Ring Кольцо отсчётов (<code>kf::ui::SampleRing</code>)
+    template<typename Ring> struct Plot final : Widget {
+
+        /// @brief Кольцо отсчётов
+        using Samples = Ring;
+
+        /// @brief Тип отсчёта
+        using T = typename Ring::Value;
+
+    private:
+        /// @brief Страница графика
+        const Page &root;
+
+        /// @brief Метка графика
+        ui::Text label;
+
+        /// @brief Отображаемые отсчёты
+        Samples &samples;
+
+    public:
+        explicit Plot(
+            Page &root,
+            ui::Text label,
+            Samples &samples) :
+            Widget{root},
+            root{root},
+            label{label},
+            samples{samples} {}
+
+        /// @brief Запросить перерисовку, если появились новые отсчёты и страница графика активна
+        /// @details Вызывается в контексте UI перед <code>UI::poll</code>
+        void refresh() {
+            if (samples.takeChanged() and UI::instance().isActive(root)) {
+                UI::instance().addEvent(Event::Update());
+            }
+        }
+
+        void doRender(RenderImpl &render) const override {
+            render.string(label);
+            render.colon();
+
+            const auto total = samples.total();
+            const auto stored = static_cast<u32>(samples.count());
+
+            if (stored == 0) {
+                return;
+            }
+
+            const auto width = static_cast<u32>(min(render.plotWidth(), static_cast<usize>(stored)));
+
+            if (width == 0) {
+                kf_if_constexpr (kf::is_floating_point<T>::value) {
+                    render.number(static_cast<float>(samples.at(total - 1)), 3);
+                } else {
+                    render.number(samples.at(total - 1));
+                }
+                return;
+            }
+
+            const T low = samples.lowest();
+            const T high = samples.highest();
+
+            for (auto ticket = total - width; ticket != total; ticket += 1) {
+                render.plotColumn(level(samples.at(ticket), low, high));
+            }
+        }
+
+        ui::Text caption() const override { return label; }
+
+    private:
+        /// @brief Высота столбца отсчёта
+        static u8 level(T value, T low, T high) {
+            constexpr auto top = RenderImpl::plot_levels - 1;
+
+            // Отсчёт, добавленный во время отрисовки, может выйти за пределы
+            if (not(value > low)) {
+                return 0;
+            }
+
+            if (not(value < high)) {
+                return top;
+            }
+
+            kf_if_constexpr (kf::is_floating_point<T>::value) {
+                return static_cast<u8>((value - low) * top / (high - low) + static_cast<T>(0.5));
+            } else {
+                return static_cast<u8>((static_cast<i64>(value) - low) * top / (static_cast<i64>(high) - low));
+            }
+        }
+    };
+
     /// @brief Добавляет метку к виджету
     /// @tparam W Тип реализации виджета, к которому будет добавлена метка
     template<typename W> struct Labeled final : Widget {
@@ -438,7 +1354,7 @@ public:
 
     private:
         /// @brief Метка
-        const char *label;
+        ui::Text label;
 
         /// @brief Виджет
         W impl;
@@ -446,7 +1362,7 @@ public:
     public:
         explicit Labeled(
             Page &root,
-            const char *label,
+            ui::Text label,
             W impl) :
             Widget{root},
             label{label},
@@ -456,16 +1372,25 @@ public:
 
         bool onChange(int direction) override { return impl.onChange(direction); }
 
+        usize stateSize() const override { return impl.stateSize(); }
+
+        void saveState(u8 *out) const override { impl.saveState(out); }
+
+        void restoreState(const u8 *in) override { impl.restoreState(in); }
+
         void doRender(RenderImpl &render) const override {
             render.string(label);
             render.colon();
             impl.doRender(render);
         }
+
+        ui::Text caption() const override { return label; }
     };
 
     /// @brief Спин-бокс - Виджет для изменения арифметического значения в указанном режиме
+    /// @tparam T Тип значения: арифметический или <code>kf::ui::Fixed</code>
     template<typename T> struct SpinBox final : Widget {
-        static_assert(kf::is_arithmetic<T>::value, "T must be arithmetic");
+        static_assert(kf::is_arithmetic<T>::value or ui::is_fixed<T>::value, "T must be arithmetic or fixed-point");
 
         /// @brief Тип скалярной величины виджета
         using Value = T;
@@ -541,6 +1466,24 @@ public:
             render.variableEnd();
         }
 
+        usize stateSize() const override { return sizeof(bool) + sizeof(T); }
+
+        void saveState(u8 *out) const override {
+            ui::snapshotWrite(out, is_step_setting_mode);
+            ui::snapshotWrite(out + sizeof(bool), step);
+        }
+
+        void restoreState(const u8 *in) override {
+            is_step_setting_mode = ui::snapshotRead<u8>(in) != 0;
+
+            const auto saved_step = ui::snapshotRead<T>(in + sizeof(bool));
+
+            // Нулевой или нечисловой шаг не восстанавливается
+            if (saved_step == saved_step and not(saved_step == T{})) {
+                step = saved_step;
+            }
+        }
+
     private:
         void displayNumber(RenderImpl &render, const T &number) const {
             kf_if_constexpr (kf::is_floating_point<T>::value) {
@@ -580,12 +1523,159 @@ public:
                 step /= step_multiplier;
 
                 // Защита от слишком маленьких шагов
-                kf_if_constexpr (kf::is_integral<T>::value) {
-                    if (step < 1) { step = 1; }
+                kf_if_constexpr (not kf::is_floating_point<T>::value) {
+                    if (step < ui::Epsilon<T>::value()) { step = ui::Epsilon<T>::value(); }
                 }
             }
         }
     };
+
+    // built-in pages
+
+    /// @brief Консоль - Страница журнала строк
+    /// @details Строки добавляются из любых задач без блокировок (см. <code>kf::ui::LogRing</code>).
+    /// Каждая строка - виджет страницы, поэтому форматируются только видимые строки.
+    /// Кольцо - параметр шаблона: заголовок кольца (и <code>std::atomic</code>) подключается только при использовании консоли
+    /// @tparam Ring Кольцо строк (<code>kf::ui::LogRing</code>)
+    template<typename Ring> struct Console final : Page {
+
+        /// @brief Кол-во хранимых строк
+        static constexpr usize lines_total{Ring::lines_total};
+
+        /// @brief Размер строки, включая завершающий ноль
+        static constexpr usize line_size{Ring::line_size};
+
+    private:
+        /// @brief Виджет строки журнала
+        struct Line final : Widget {
+
+            /// @brief Консоль строки
+            const Console *console{nullptr};
+
+            void doRender(RenderImpl &render) const override {
+                char text[line_size];
+
+                if (console->ring.read(static_cast<usize>(this - console->lines), text)) {
+                    render.string(text);
+                }
+            }
+        };
+
+        /// @brief Кольцо строк
+        Ring ring{};
+
+        /// @brief Виджеты строк (0 - самая новая)
+        Line lines[lines_total];
+
+    public:
+        explicit Console(ui::Text title) :
+            Page{title} {
+            for (auto &line: lines) {
+                line.console = this;
+                this->addWidget(line);
+            }
+        }
+
+        /// @brief Добавить строку
+        /// @details Допускается вызов из любой задачи
+        void append(const char *text) {
+            ring.append(text);
+        }
+
+        /// @brief Запросить перерисовку, если появились новые строки и консоль активна
+        /// @details Вызывается в контексте UI перед <code>UI::poll</code>
+        void refresh() {
+            if (ring.takeChanged() and UI::instance().isActive(*this)) {
+                UI::instance().addEvent(Event::Update());
+            }
+        }
+    };
+
+    /// @brief Переход на ленивую страницу
+    /// @details Страница создаётся в области памяти UI (<code>UI::bindPageArena</code>) при переходе
+    /// и уничтожается при переходе на другую страницу, поэтому в памяти находится не более одной ленивой страницы.
+    /// Связывается только со статическими страницами (<code>Page::link</code>)
+    struct LazyLink : Widget {
+        friend struct UI;
+
+    protected:
+        /// @brief Заголовок создаваемой страницы
+        ui::Text title;
+
+    public:
+        explicit LazyLink(ui::Text title) :
+            title{title} {}
+
+        /// @brief Создаёт страницу и устанавливает её активной
+        bool onClick() override {
+            UI &ui = UI::instance();
+            Page *origin = ui.active_page;
+
+            if (nullptr == origin or origin == ui.lazy_page) {
+                return false;
+            }
+
+            if (nullptr != ui.lazy_page) {
+                ui.releaseLazyPage();
+            }
+
+            Page *page = create(ui.page_arena);
+
+            if (nullptr == page) {
+                return false;
+            }
+
+            page->addWidget(origin->to_this);
+
+            ui.lazy_page = page;
+            ui.lazy_link = this;
+            ui.bindPage(*page);
+            return true;
+        }
+
+        void doRender(RenderImpl &render) const override {
+            render.arrow();
+            render.string(title);
+        }
+
+        ui::Text caption() const override { return title; }
+
+    protected:
+        /// @brief Создать страницу в области памяти
+        /// @returns nullptr - Страница не помещается в область
+        virtual Page *create(kf::slice<u8> arena) = 0;
+
+        /// @brief Уничтожить созданную страницу
+        virtual void destroy(Page &page) = 0;
+    };
+
+    /// @brief Ленивая страница
+    /// @tparam P Тип страницы: наследник <code>Page</code> с виджетами-полями, конструируемый от заголовка (<code>kf::ui::Text</code>)
+    template<typename P> struct LazyPage final : LazyLink {
+        static_assert(kf::is_base_of<Page, P>::value, "P must be a Page Subclass");
+
+        /// @brief Размер области памяти, достаточный для страницы
+        static constexpr usize arenaSize() { return sizeof(P) + alignof(P) - 1; }
+
+        explicit LazyPage(ui::Text title) :
+            LazyLink{title} {}
+
+    protected:
+        Page *create(kf::slice<u8> arena) override {
+            const auto begin = reinterpret_cast<usize>(arena.data());
+            const auto aligned = (begin + alignof(P) - 1) & ~(alignof(P) - 1);
+
+            if (nullptr == arena.data() or aligned + sizeof(P) > begin + arena.size()) {
+                return nullptr;
+            }
+
+            return ::new (reinterpret_cast<void *>(aligned)) P{this->title};
+        }
+
+        void destroy(Page &page) override {
+            static_cast<P &>(page).~P();
+        }
+    };
 };
 
 }// namespace kf
@@ -0,0 +1,437 @@
+#pragma once
+
+#include <kf/algorithm.hpp>
+#include <kf/aliases.hpp>
+#include <kf/attributes.hpp>
+#include <kf/fn.hpp>
+#include <kf/slice.hpp>
+
+#include "kf/ui/Font5x7.hpp"
+#include "kf/ui/Format.hpp"
+#include "kf/ui/Render.hpp"
+
+namespace kf {
+namespace ui {
+
+/// @brief Система отрисовки для цветных дисплеев RGB565 без полного кадрового буфера
+/// @details Вызовы рендера раскладываются в сетку знакомест (1 байт на знакоместо),
+/// затем экран растеризуется горизонтальными полосами в небольшой переиспользуемый буфер.
+/// Полосы, строки которых не изменились с прошлого кадра, не выводятся.
+/// С двумя буферами полос и обработчиком ожидания вывод полосы (например, по DMA) идёт одновременно с растеризацией следующей
+struct BandRender : Render<BandRender> {
+    friend struct Render<BandRender>;
+
+    /// @brief Пиксель RGB565
+    using Pixel = u16;
+
+    /// @brief Единица измерения экрана в точках
+    using PixelUnit = u16;
+
+    /// @brief Единица измерения сетки в знакоместах
+    using GlyphUnit = u8;
+
+    /// @brief Наибольшее кол-во строк сетки (по биту на строку в маске изменений)
+    static constexpr GlyphUnit rows_max{64};
+
+    /// @brief Ширина знакоместа в точках шрифта (глиф и интервал)
+    static constexpr u8 cell_width{Font5x7::width + 1};
+
+    /// @brief Высота знакоместа в точках шрифта (глиф и интервал)
+    static constexpr u8 cell_height{Font5x7::height + 1};
+
+    /// @brief Размер сетки знакомест для экрана
+    static constexpr usize cellsSize(PixelUnit width, PixelUnit height, u8 scale) {
+        return static_cast<usize>(width / (cell_width * scale)) * static_cast<usize>(height / (cell_height * scale));
+    }
+
+    /// @brief Настройки рендера
+    struct Settings {
+
+        /// @brief Обработчик вывода полосы (Верхняя строка полосы, высота полосы, пиксели полосы по строкам)
+        /// @details Полоса занимает всю ширину экрана.
+        /// Без обработчика ожидания буфер полосы переиспользуется сразу после возврата, поэтому вывод должен завершиться в обработчике.
+        /// С обработчиком ожидания обработчик вывода может только запустить передачу
+        using BandHandler = kf::fn<void(PixelUnit, PixelUnit, const kf::slice<const Pixel> &)>;
+
+        /// @brief Обработчик ожидания завершения самой ранней из запущенных передач полос
+        using WaitHandler = kf::fn<void()>;
+
+        static constexpr PixelUnit width_default{320};
+        static constexpr PixelUnit height_default{240};
+
+        /// @brief Обработчик вывода полосы
+        BandHandler on_band{nullptr};
+
+        /// @brief Обработчик ожидания завершения передачи полосы
+        /// @details Вызывается перед повторным использованием буфера, передача которого могла не завершиться,
+        /// и в конце кадра для каждой незавершённой передачи
+        WaitHandler on_band_wait{nullptr};
+
+        /// @brief Сетка знакомест (см. <code>BandRender::cellsSize</code>)
+        kf::slice<u8> cells{};
+
+        /// @brief Буфер полосы. Высота полосы - <code>strip.size() / width</code> строк точек
+        kf::slice<Pixel> strip{};
+
+        /// @brief Второй буфер полосы (Необязательно): полосы растеризуются в буферы поочерёдно.
+        /// Высота полосы - по меньшему из буферов
+        kf::slice<Pixel> strip_back{};
+
+        /// @brief Ширина экрана
+        PixelUnit width{width_default};
+
+        /// @brief Высота экрана
+        PixelUnit height{height_default};
+
+        /// @brief Масштаб шрифта
+        u8 scale{1};
+
+        /// @brief Цвет текста
+        Pixel foreground{0xFFFF};
+
+        /// @brief Цвет фона
+        Pixel background{0x0000};
+
+        /// @brief Менять порядок байт пикселя (Для дисплеев, принимающих старший байт первым)
+        bool swap_bytes{false};
+    };
+
+    Settings settings{};
+
+    /// @brief Перерисовать весь экран при следующем выводе
+    void invalidate() { full_redraw = true; }
+
+private:
+    /// @brief Признак контраста в коде знакоместа
+    static constexpr u8 contrast_flag{0x80};
+
+    /// @brief Код знакоместа столбца графика наименьшей высоты (Коды до <code>plot_code_first + plot_levels</code>)
+    static constexpr u8 plot_code_first{0x01};
+
+    u64 dirty_rows{0};
+    GlyphUnit rows{0}, cols{0};
+    GlyphUnit cursor_row{0}, cursor_col{0};
+    bool contrast_mode{false};
+    bool full_redraw{true};
+
+    kf_nodiscard usize widgetsAvailableImpl() const {
+        return cursor_row < rows ? rows - cursor_row : 0;
+    }
+
+    kf_nodiscard usize cursorRowImpl() const {
+        return cursor_row;
+    }
+
+    void prepareImpl() {
+        updateGeometry();
+        cursor_row = 0;
+        cursor_col = 0;
+        contrast_mode = false;
+    }
+
+    void finishImpl() {
+        while (cursor_row < rows) {
+            newLine();
+        }
+
+        flush();
+        cursor_row = 0;
+        cursor_col = 0;
+    }
+
+    kf_nodiscard bool rowsRedrawSupportedImpl() const { return true; }
+
+    void rowsBeginImpl() {
+        updateGeometry();
+    }
+
+    void rowsEndImpl() {
+        flush();
+        cursor_row = 0;
+        cursor_col = 0;
+    }
+
+    void rowBeginImpl(usize row, usize) {
+        // Первая строка сетки занята заголовком
+        cursor_row = static_cast<GlyphUnit>(row + 1);
+        cursor_col = 0;
+        contrast_mode = false;
+    }
+
+    void rowEndImpl() {
+        newLine();
+    }
+
+    void titleImpl(const char *title) {
+        print(title);
+        newLine();
+    }
+
+    void stringImpl(const char *str) {
+        print(str);
+    }
+
+    void flashTitleImpl(const char *title) {
+        formatFlashString(title, [this](char c) { put(c); });
+        newLine();
+    }
+
+    void flashStringImpl(const char *str) {
+        formatFlashString(str, [this](char c) { put(c); });
+    }
+
+    void numberImpl(i32 integer) {
+        formatInteger(integer, [this](char c) { put(c); });
+    }
+
+    void numberImpl(f64 real, u8 rounding) {
+        formatReal(real, rounding, [this](char c) { put(c); });
+    }
+
+    void decimalImpl(i32 scaled, u8 digits) {
+        formatDecimal(scaled, digits, [this](char c) { put(c); });
+    }
+
+    kf_nodiscard usize plotWidthImpl() const {
+        return cursor_col < cols ? cols - cursor_col : 0;
+    }
+
+    void plotColumnImpl(u8 level) {
+        putCode(static_cast<u8>(plot_code_first + (level < plot_levels ? level : plot_levels - 1)) | (contrast_mode ? contrast_flag : 0));
+    }
+
+    void arrowImpl() {
+        print("-> ");
+    }
+
+    void colonImpl() {
+        print(": ");
+    }
+
+    void contrastBeginImpl() {
+        contrast_mode = true;
+    }
+
+    void contrastEndImpl() {
+        contrast_mode = false;
+    }
+
+    void blockBeginImpl() {
+        put('[');
+    }
+
+    void blockEndImpl() {
+        put(']');
+    }
+
+    void variableBeginImpl() {
+        put('<');
+    }
+
+    void variableEndImpl() {
+        put('>');
+    }
+
+    void widgetBeginImpl(usize) {}
+
+    void widgetEndImpl() {
+        newLine();
+    }
+
+    // help methods...
+
+    /// @brief Пересчитать размер сетки
+    void updateGeometry() {
+        const auto cell_w = cell_width * settings.scale;
+        const auto cell_h = cell_height * settings.scale;
+
+        if (cell_w == 0) {
+            rows = 0;
+            cols = 0;
+            return;
+        }
+
+        const usize new_cols = min(static_cast<usize>(settings.width / cell_w), static_cast<usize>(0xFF));
+        usize new_rows = min(static_cast<usize>(settings.height / cell_h), static_cast<usize>(rows_max));
+
+        if (new_cols == 0) {
+            new_rows = 0;
+        } else {
+            new_rows = min(new_rows, settings.cells.size() / new_cols);
+        }
+
+        if (new_rows != rows or new_cols != cols) {
+            rows = static_cast<GlyphUnit>(new_rows);
+            cols = static_cast<GlyphUnit>(new_cols);
+            full_redraw = true;
+        }
+    }
+
+    void print(const char *str) {
+        formatString(str, [this](char c) { put(c); });
+    }
+
+    /// @brief Записать код в знакоместо под курсором
+    void put(char c) {
+        if (c < Font5x7::first or c > Font5x7::last) {
+            c = '?';
+        }
+
+        putCode(static_cast<u8>(c) | (contrast_mode ? contrast_flag : 0));
+    }
+
+    void putCode(u8 code) {
+        if (cursor_row >= rows or cursor_col >= cols) {
+            return;
+        }
+
+        u8 &cell = settings.cells.data()[cursor_row * cols + cursor_col];
+
+        if (cell != code) {
+            cell = code;
+            dirty_rows |= u64(1) << cursor_row;
+        }
+
+        cursor_col += 1;
+    }
+
+    /// @brief Очистить остаток строки и перейти на следующую
+    void newLine() {
+        if (cursor_row >= rows) {
+            return;
+        }
+
+        contrast_mode = false;
+
+        while (cursor_col < cols) {
+            putCode(' ');
+        }
+
+        cursor_row += 1;
+        cursor_col = 0;
+    }
+
+    /// @brief Растеризовать и вывести изменившиеся полосы
+    void flush() {
+        if (not settings.on_band or nullptr == settings.strip.data() or 0 == settings.width) {
+            return;
+        }
+
+        Pixel *const strips[2]{settings.strip.data(), settings.strip_back.data()};
+        const u8 strips_total = nullptr == strips[1] ? 1 : 2;
+
+        usize strip_size = settings.strip.size();
+
+        if (strips_total == 2) {
+            strip_size = min(strip_size, settings.strip_back.size());
+        }
+
+        const auto band_height = static_cast<PixelUnit>(min(strip_size / settings.width, static_cast<usize>(settings.height)));
+
+        if (band_height == 0) {
+            return;
+        }
+
+        const auto cell_h = static_cast<PixelUnit>(cell_height * settings.scale);
+        const bool waiting = static_cast<bool>(settings.on_band_wait);
+
+        // Кол-во запущенных передач, завершение которых ещё не ожидалось
+        u8 in_flight{0};
+        u8 strip_index{0};
+
+        for (PixelUnit y = 0; y < settings.height; y += band_height) {
+            const auto height = static_cast<PixelUnit>(min(band_height, static_cast<PixelUnit>(settings.height - y)));
+
+            if (not full_redraw and not bandDirty(y / cell_h, (y + height - 1) / cell_h)) {
+                continue;
+            }
+
+            // Все буферы заняты передачами: самая ранняя использовала текущий буфер
+            if (waiting and in_flight == strips_total) {
+                settings.on_band_wait();
+                in_flight -= 1;
+            }
+
+            Pixel *strip = strips[strip_index];
+
+            for (PixelUnit line = 0; line < height; line += 1) {
+                rasterizeLine(y + line, strip + line * settings.width);
+            }
+
+            settings.on_band(y, height, {strip, static_cast<usize>(height) * settings.width});
+
+            if (waiting) {
+                in_flight += 1;
+            }
+
+            strip_index = static_cast<u8>((strip_index + 1) % strips_total);
+        }
+
+        // Буферы свободны к концу кадра
+        for (; in_flight > 0; in_flight -= 1) {
+            settings.on_band_wait();
+        }
+
+        dirty_rows = 0;
+        full_redraw = false;
+    }
+
+    kf_nodiscard bool bandDirty(usize row_first, usize row_last) const {
+        for (auto row = row_first; row <= row_last and row < rows; row += 1) {
+            if (dirty_rows & (u64(1) << row)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// @brief Растеризовать строку точек экрана
+    void rasterizeLine(PixelUnit y, Pixel *out) const {
+        const auto scale = settings.scale;
+        const auto row = y / (cell_height * scale);
+        const auto glyph_line = static_cast<u8>((y % (cell_height * scale)) / scale);
+
+        const Pixel foreground = pixel(settings.foreground);
+        const Pixel background = pixel(settings.background);
+
+        PixelUnit x{0};
+
+        if (row < rows) {
+            const u8 *cells = settings.cells.data() + row * cols;
+
+            for (GlyphUnit col = 0; col < cols; col += 1) {
+                const u8 code = cells[col];
+                const bool inverted = code & contrast_flag;
+                const u8 symbol = code & ~contrast_flag;
+                const u8 *glyph = Font5x7::glyph(static_cast<char>(symbol));
+
+                // Столбец графика заполняет знакоместо снизу: уровень - строка точек
+                const bool plot = symbol >= plot_code_first and symbol < plot_code_first + plot_levels;
+                const bool plot_line = glyph_line >= cell_height - (symbol - plot_code_first + 1);
+
+                for (u8 gx = 0; gx < cell_width; gx += 1) {
+                    const bool on = plot ?
+                                        (plot_line and gx < cell_width - 1) :
+                                        (gx < Font5x7::width and glyph_line < Font5x7::height and (glyph[gx] >> glyph_line) & 1);
+                    const Pixel color = (on != inverted) ? foreground : background;
+
+                    for (u8 s = 0; s < scale; s += 1) {
+                        out[x] = color;
+                        x += 1;
+                    }
+                }
+            }
+        }
+
+        for (; x < settings.width; x += 1) {
+            out[x] = background;
+        }
+    }
+
+    kf_nodiscard Pixel pixel(Pixel color) const {
+        return settings.swap_bytes ? static_cast<Pixel>((color >> 8) | (color << 8)) : color;
+    }
+};
+
+}// namespace ui
+}// namespace kf
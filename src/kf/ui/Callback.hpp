@@ -0,0 +1,63 @@
+#pragma once
+
+namespace kf {
+namespace ui {
+
+/// @brief Компактный обработчик: указатель на функцию и контекст
+/// @details Занимает два указателя и не использует динамическую память.
+/// Альтернатива <code>kf::fn</code> для больших статических меню
+/// @tparam Signature Сигнатура обработчика
+template<typename Signature> struct Callback;
+
+template<typename R, typename... Args> struct Callback<R(Args...)> {
+
+    /// @brief Функция, принимающая контекст первым аргументом
+    using Function = R (*)(void *context, Args...);
+
+private:
+    /// @brief Вызываемая функция
+    Function function{nullptr};
+
+    /// @brief Контекст вызова
+    void *context{nullptr};
+
+public:
+    constexpr Callback() = default;
+
+    constexpr Callback(decltype(nullptr)) {}
+
+    constexpr Callback(Function function, void *context = nullptr) :
+        function{function}, context{context} {}
+
+    /// @brief Обработчик из функции, известной на этапе компиляции
+    /// @tparam Fn Вызываемая функция
+    template<R (*Fn)(Args...)> static constexpr Callback bind() {
+        return Callback{&invokeFunction<Fn>};
+    }
+
+    /// @brief Обработчик из метода объекта
+    /// @tparam T Тип объекта
+    /// @tparam M Вызываемый метод
+    /// @param object Объект, для которого будет вызван метод
+    template<typename T, R (T::*M)(Args...)> static constexpr Callback bind(T &object) {
+        return Callback{&invokeMethod<T, M>, &object};
+    }
+
+    /// @brief Обработчик установлен
+    explicit constexpr operator bool() const { return nullptr != function; }
+
+    /// @brief Вызвать обработчик
+    R operator()(Args... args) const { return function(context, args...); }
+
+private:
+    template<R (*Fn)(Args...)> static R invokeFunction(void *, Args... args) {
+        return Fn(args...);
+    }
+
+    template<typename T, R (T::*M)(Args...)> static R invokeMethod(void *context, Args... args) {
+        return (static_cast<T *>(context)->*M)(args...);
+    }
+};
+
+}// namespace ui
+}// namespace kf
@@ -43,6 +43,20 @@ public:
         /// @details Может содержать value
         PageCursorMove = enumerate(2),
 
+        /// @brief Смещение курсора на окно виджетов
+        /// @details value - кол-во окон
+        PageScroll = enumerate(5),
+
+        /// @brief Переход к виджету по первым буквам метки
+        /// @details code - номер латинской буквы (0..25)
+        PageSeek = enumerate(6),
+
+        // События указателя
+
+        /// @brief Касание строки экрана: фокус и клик виджета под указателем
+        /// @details code - строка экрана (0..31)
+        PointerTap = enumerate(7),
+
         // События виджета
 
         /// @brief Клик
@@ -77,6 +91,11 @@ public:
         return (result & sign_bit_mask) ? static_cast<Value>(result | ~value_mask) : result;
     }
 
+    /// @brief Значение события без знака
+    kf_nodiscard constexpr u8 code() const {
+        return static_cast<u8>(storage & value_mask);
+    }
+
     // Готовые экземпляры
 
     static constexpr Event None() { return Event{Type::None}; }
@@ -85,9 +104,25 @@ public:
 
     static constexpr Event PageCursorMove(Value offset) { return Event{Type::PageCursorMove, offset}; }
 
+    static constexpr Event PageScroll(Value windows) { return Event{Type::PageScroll, windows}; }
+
+    /// @brief Переход по букве
+    /// @param letter Латинская буква в любом регистре. Иные символы дают <code>None</code>
+    static constexpr Event PageSeek(char letter) {
+        return (letter >= 'a' and letter <= 'z') ? Event{Type::PageSeek, static_cast<Value>(letter - 'a')} :
+               (letter >= 'A' and letter <= 'Z') ? Event{Type::PageSeek, static_cast<Value>(letter - 'A')} :
+                                                   None();
+    }
+
     static constexpr Event WidgetClick() { return Event{Type::WidgetClick}; }
 
     static constexpr Event WidgetValueChange(Value delta) { return Event{Type::WidgetValueChange, delta}; }
+
+    /// @brief Касание строки экрана
+    /// @param row Строка экрана (0..31). Строки за пределами кода события дают <code>None</code>
+    static constexpr Event PointerTap(u8 row) {
+        return row <= value_mask ? Event{Type::PointerTap, static_cast<Value>(row)} : None();
+    }
 };
 
 }// namespace ui
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stdio.h>// NOLINT(*-deprecated-headers)
+
+#include <kf/aliases.hpp>
+
+#include "kf/ui/Storage.hpp"
+
+namespace kf {
+namespace ui {
+
+/// @brief Хранилище в файле
+/// @details Замена энергонезависимой памяти для тестов и отладки на Linux
+struct FileStorage final : Storage {
+
+private:
+    /// @brief Путь к файлу
+    const char *path;
+
+public:
+    explicit FileStorage(const char *path) :
+        path{path} {}
+
+    bool read(usize offset, u8 *data, usize size) override {
+        FILE *file = fopen(path, "rb");
+
+        if (nullptr == file) {
+            return false;
+        }
+
+        const bool ok = 0 == fseek(file, static_cast<long>(offset), SEEK_SET) and size == fread(data, 1, size, file);
+        fclose(file);
+        return ok;
+    }
+
+    bool write(usize offset, const u8 *data, usize size) override {
+        FILE *file = fopen(path, "r+b");
+
+        if (nullptr == file) {
+            file = fopen(path, "w+b");
+        }
+
+        if (nullptr == file) {
+            return false;
+        }
+
+        const bool ok = 0 == fseek(file, static_cast<long>(offset), SEEK_SET) and size == fwrite(data, 1, size, file);
+        return 0 == fclose(file) and ok;
+    }
+};
+
+}// namespace ui
+}// namespace kf
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <kf/aliases.hpp>
+#include <kf/attributes.hpp>
+#include <kf/type_traits.hpp>
+
+namespace kf {
+namespace ui {
+
+/// @brief Тип промежуточных результатов умножения и деления чисел с фиксированной точкой
+template<typename I> struct FixedWide {
+    using type = i64;
+};
+
+template<> struct FixedWide<i8> {
+    using type = i32;
+};
+
+template<> struct FixedWide<i16> {
+    using type = i32;
+};
+
+/// @brief Десятичное число с фиксированной точкой
+/// @details Все операции целочисленные: для ядер без FPU (AVR и др.) исключает программную эмуляцию float.
+/// Неявно конструируется от целого, вещественные константы задаются через <code>Fixed::from</code>
+/// @tparam D Кол-во знаков после запятой: множитель 10^D должен помещаться в тип хранения (i8 - до 2, i16 - до 4, i32 - до 9)
+/// @tparam I Знаковый целочисленный тип хранения (до 32 бит)
+template<u8 D, typename I = i32> struct Fixed {
+    static_assert(kf::is_integral<I>::value, "I must be integral");
+    static_assert(kf::is_signed<I>::value, "I must be signed");
+    static_assert(sizeof(I) <= 4, "I must be at most 32 bit");
+    static_assert(D <= (sizeof(I) == 1 ? 2 : sizeof(I) == 2 ? 4 : 9), "10^D must fit into I");
+
+    /// @brief Тип хранения
+    using Raw = I;
+
+    /// @brief Кол-во знаков после запятой
+    static constexpr u8 digits{D};
+
+private:
+    using Wide = typename FixedWide<I>::type;
+
+    static constexpr Wide power(u8 n) { return n == 0 ? 1 : 10 * power(static_cast<u8>(n - 1)); }
+
+    /// @brief Значение, умноженное на 10^D
+    I mantissa;
+
+    struct RawTag {};
+
+    constexpr Fixed(I raw, RawTag) :
+        mantissa{raw} {}
+
+public:
+    /// @brief Множитель представления (10^D)
+    static constexpr Wide scale() { return power(D); }
+
+    constexpr Fixed() :
+        mantissa{0} {}
+
+    constexpr Fixed(int integer) :// NOLINT(*-explicit-constructor)
+        mantissa{static_cast<I>(integer * scale())} {}
+
+    /// @brief Неявное преобразование из вещественного числа запрещено: используйте <code>Fixed::from</code>
+    Fixed(f64) = delete;
+
+    /// @brief Из представления (Значение, умноженное на 10^D)
+    static constexpr Fixed fromRaw(I raw) { return Fixed{raw, RawTag{}}; }
+
+    /// @brief Из вещественной константы с округлением
+    /// @details Предназначено для вычисления на этапе компиляции
+    static constexpr Fixed from(f64 real) {
+        return fromRaw(static_cast<I>(real * static_cast<f64>(scale()) + (real < 0 ? -0.5 : 0.5)));
+    }
+
+    /// @brief Наименьшее положительное значение
+    static constexpr Fixed epsilon() { return fromRaw(1); }
+
+    /// @brief Представление (Значение, умноженное на 10^D)
+    kf_nodiscard constexpr I raw() const { return mantissa; }
+
+    /// @brief Преобразование в вещественное число
+    explicit constexpr operator f64() const { return static_cast<f64>(mantissa) / static_cast<f64>(scale()); }
+
+    /// @brief Преобразование в вещественное число
+    explicit constexpr operator f32() const { return static_cast<f32>(mantissa) / static_cast<f32>(scale()); }
+
+    // Арифметика
+
+    constexpr Fixed operator-() const { return fromRaw(static_cast<I>(-mantissa)); }
+
+    friend constexpr Fixed operator+(Fixed a, Fixed b) { return fromRaw(static_cast<I>(a.mantissa + b.mantissa)); }
+
+    friend constexpr Fixed operator-(Fixed a, Fixed b) { return fromRaw(static_cast<I>(a.mantissa - b.mantissa)); }
+
+    friend constexpr Fixed operator*(Fixed a, Fixed b) {
+        return fromRaw(static_cast<I>(static_cast<Wide>(a.mantissa) * b.mantissa / scale()));
+    }
+
+    friend constexpr Fixed operator/(Fixed a, Fixed b) {
+        return fromRaw(static_cast<I>(static_cast<Wide>(a.mantissa) * scale() / b.mantissa));
+    }
+
+    /// @brief Умножение на целое без приведения к масштабу
+    friend constexpr Fixed operator*(int k, Fixed a) { return fromRaw(static_cast<I>(k * a.mantissa)); }
+
+    /// @brief Умножение на целое без приведения к масштабу
+    friend constexpr Fixed operator*(Fixed a, int k) { return fromRaw(static_cast<I>(a.mantissa * k)); }
+
+    Fixed &operator+=(Fixed other) { return *this = *this + other; }
+
+    Fixed &operator-=(Fixed other) { return *this = *this - other; }
+
+    Fixed &operator*=(Fixed other) { return *this = *this * other; }
+
+    Fixed &operator/=(Fixed other) { return *this = *this / other; }
+
+    // Сравнение
+
+    friend constexpr bool operator==(Fixed a, Fixed b) { return a.mantissa == b.mantissa; }
+
+    friend constexpr bool operator!=(Fixed a, Fixed b) { return a.mantissa != b.mantissa; }
+
+    friend constexpr bool operator<(Fixed a, Fixed b) { return a.mantissa < b.mantissa; }
+
+    friend constexpr bool operator>(Fixed a, Fixed b) { return a.mantissa > b.mantissa; }
+
+    friend constexpr bool operator<=(Fixed a, Fixed b) { return a.mantissa <= b.mantissa; }
+
+    friend constexpr bool operator>=(Fixed a, Fixed b) { return a.mantissa >= b.mantissa; }
+};
+
+/// @brief Тип является числом с фиксированной точкой
+template<typename T> struct is_fixed {
+    static constexpr bool value{false};
+};
+
+template<u8 D, typename I> struct is_fixed<Fixed<D, I>> {
+    static constexpr bool value{true};
+};
+
+/// @brief Наименьший шаг изменения значения: 1 для целых, <code>Fixed::epsilon</code> для фиксированной точки
+template<typename T> struct Epsilon {
+    static constexpr T value() { return static_cast<T>(1); }
+};
+
+template<u8 D, typename I> struct Epsilon<Fixed<D, I>> {
+    static constexpr Fixed<D, I> value() { return Fixed<D, I>::epsilon(); }
+};
+
+}// namespace ui
+}// namespace kf
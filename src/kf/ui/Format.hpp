@@ -0,0 +1,148 @@
+#pragma once
+
+// for avr capability
+#include <math.h>// NOLINT(*-deprecated-headers)
+
+#include <kf/aliases.hpp>
+
+#include "kf/ui/Text.hpp"
+
+namespace kf {
+namespace ui {
+
+/// @brief Вывести строку посимвольно
+/// @param str Строка
+/// @param out Приёмник символа <code>void(char)</code>
+template<typename Out> void formatString(const char *str, Out &&out) {
+    if (nullptr == str) {
+        str = "nullptr";
+    }
+
+    while (*str != '\x00') {
+        out(*str);
+        str += 1;
+    }
+}
+
+/// @brief Вывести строку из памяти программ посимвольно
+/// @param str Строка в памяти программ
+/// @param out Приёмник символа <code>void(char)</code>
+template<typename Out> void formatFlashString(const char *str, Out &&out) {
+    if (nullptr == str) {
+        formatString(str, out);
+        return;
+    }
+
+    for (char c = flashRead(str); c != '\x00'; c = flashRead(str)) {
+        out(c);
+        str += 1;
+    }
+}
+
+/// @brief Вывести целое число посимвольно
+/// @param integer Число
+/// @param out Приёмник символа <code>void(char)</code>
+template<typename Out> void formatInteger(i32 integer, Out &&out) {
+    if (integer == 0) {
+        out('0');
+        return;
+    }
+
+    if (integer < 0) {
+        integer = -integer;
+        out('-');
+    }
+
+    char digits_buffer[12];
+
+    auto digits_total{0};
+    while (integer > 0) {
+        const auto base = 10;
+
+        digits_buffer[digits_total] = static_cast<char>(integer % base + '0');
+        digits_total += 1;
+        integer /= base;
+    }
+
+    for (auto i = digits_total - 1; i >= 0; i -= 1) {
+        out(digits_buffer[i]);
+    }
+}
+
+/// @brief Вывести десятичное число с фиксированной точкой посимвольно
+/// @details Только целочисленные операции
+/// @param scaled Число, умноженное на 10^digits
+/// @param digits Кол-во знаков после запятой
+/// @param out Приёмник символа <code>void(char)</code>
+template<typename Out> void formatDecimal(i32 scaled, u8 digits, Out &&out) {
+    u32 magnitude = static_cast<u32>(scaled);
+
+    if (scaled < 0) {
+        magnitude = 0u - magnitude;
+        out('-');
+    }
+
+    char digits_buffer[12];
+
+    auto digits_total{0};
+    while (magnitude > 0 or digits_total <= digits) {
+        const auto base = 10;
+
+        digits_buffer[digits_total] = static_cast<char>(magnitude % base + '0');
+        digits_total += 1;
+        magnitude /= base;
+
+        if (digits_total >= static_cast<int>(sizeof(digits_buffer))) {
+            break;
+        }
+    }
+
+    for (auto i = digits_total - 1; i >= 0; i -= 1) {
+        out(digits_buffer[i]);
+
+        if (i == digits and digits > 0) {
+            out('.');
+        }
+    }
+}
+
+/// @brief Вывести вещественное число посимвольно
+/// @param real Число
+/// @param rounding Кол-во знаков после запятой
+/// @param out Приёмник символа <code>void(char)</code>
+template<typename Out> void formatReal(f64 real, u8 rounding, Out &&out) {
+    if (isnan(real)) {
+        formatString("nan", out);
+        return;
+    }
+
+    if (isinf(real)) {
+        formatString("inf", out);
+        return;
+    }
+
+    if (real < 0) {
+        real = -real;
+        out('-');
+    }
+
+    formatInteger(i32(real), out);
+
+    if (rounding > 0) {
+        out('.');
+
+        auto fractional = real - i32(real);
+
+        for (auto i = 0; i < rounding; i += 1) {
+            const auto base = 10;
+
+            fractional *= base;
+            const auto digit = u8(fractional);
+            out(static_cast<char>('0' + digit));
+            fractional -= digit;
+        }
+    }
+}
+
+}// namespace ui
+}// namespace kf
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <atomic>
+
+#include <kf/aliases.hpp>
+#include <kf/attributes.hpp>
+
+namespace kf {
+namespace ui {
+
+/// @brief Кольцо строк журнала фиксированного размера
+/// @details Строки добавляются из любых задач без блокировок и выделения памяти.
+/// При переполнении вытесняется самая старая строка.
+/// Читатель копирует строку и проверяет её номер последовательности, отбрасывая строку, перезаписанную во время чтения
+/// @tparam N Кол-во строк
+/// @tparam L Размер строки, включая завершающий ноль
+template<usize N, usize L> struct LogRing {
+    static_assert(N >= 1, "N >= 1");
+    static_assert(L >= 2, "L >= 2");
+
+    /// @brief Кол-во строк
+    static constexpr usize lines_total{N};
+
+    /// @brief Размер строки, включая завершающий ноль
+    static constexpr usize line_size{L};
+
+private:
+    /// @brief Строка кольца
+    struct Line {
+
+        /// @brief Номер последовательности: нечётный - идёт запись, чётный - запись строки завершена
+        std::atomic<u32> sequence{0};
+
+        /// @brief Текст строки
+        /// @details Посимвольный relaxed-доступ компилируется в обычное копирование байт
+        std::atomic<char> text[L];
+    };
+
+    /// @brief Строки
+    Line lines[N];
+
+    /// @brief Кол-во добавленных строк
+    std::atomic<u32> head{0};
+
+    /// @brief Добавлены строки с момента последней проверки
+    std::atomic<bool> changed{false};
+
+public:
+    /// @brief Добавить строку
+    /// @details Допускается вызов из любой задачи. Длинная строка усекается
+    void append(const char *text) {
+        const u32 ticket = head.fetch_add(1, std::memory_order_relaxed);
+        Line &line = lines[ticket % N];
+
+        line.sequence.store(ticket * 2 + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        usize i{0};
+
+        if (nullptr != text) {
+            for (; i < L - 1 and text[i] != '\x00'; i += 1) {
+                line.text[i].store(text[i], std::memory_order_relaxed);
+            }
+        }
+
+        line.text[i].store('\x00', std::memory_order_relaxed);
+
+        line.sequence.store(ticket * 2 + 2, std::memory_order_release);
+        changed.store(true, std::memory_order_release);
+    }
+
+    /// @brief Кол-во хранимых строк
+    kf_nodiscard usize count() const {
+        const auto total = head.load(std::memory_order_acquire);
+        return total < N ? total : N;
+    }
+
+    /// @brief Прочитать строку
+    /// @param index Индекс строки: 0 - самая новая
+    /// @param out Буфер строки
+    /// @returns false - Строки нет, либо она перезаписывается
+    bool read(usize index, char (&out)[L]) const {
+        const auto total = head.load(std::memory_order_acquire);
+
+        if (index >= (total < N ? total : N)) {
+            return false;
+        }
+
+        const u32 ticket = total - 1 - static_cast<u32>(index);
+        const Line &line = lines[ticket % N];
+        const u32 expected = ticket * 2 + 2;
+
+        if (line.sequence.load(std::memory_order_acquire) != expected) {
+            return false;
+        }
+
+        for (usize i = 0; i < L; i += 1) {
+            out[i] = line.text[i].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (line.sequence.load(std::memory_order_relaxed) != expected) {
+            return false;
+        }
+
+        out[L - 1] = '\x00';
+        return true;
+    }
+
+    /// @brief Проверить и сбросить признак новых строк
+    kf_nodiscard bool takeChanged() {
+        return changed.exchange(false, std::memory_order_acq_rel);
+    }
+};
+
+}// namespace ui
+}// namespace kf
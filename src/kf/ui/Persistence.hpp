@@ -0,0 +1,255 @@
+#pragma once
+
+#include <kf/aliases.hpp>
+#include <kf/array.hpp>
+#include <kf/attributes.hpp>
+#include <kf/type_traits.hpp>
+
+#include "kf/ui/Storage.hpp"
+
+namespace kf {
+namespace ui {
+
+/// @brief Сохранение значений виджетов в энергонезависимой памяти
+/// @details Значения (<code>SpinBox</code>, <code>ComboBox</code>, связанного с переменной <code>CheckBox</code>)
+/// располагаются в компактной версионированной раскладке. Изменения отслеживаются по теневой копии,
+/// записываются только изменившиеся записи и только после паузы в изменениях.
+/// <br>Раскладка: заголовок (метка, версия, размер данных), затем записи - байты значения и контрольный байт.
+/// @tparam N Максимальное кол-во сохраняемых значений
+template<usize N> struct Persistence {
+    static_assert(N >= 1, "N >= 1");
+
+    /// @brief Наибольший размер сохраняемого значения
+    static constexpr usize value_size_max{8};
+
+    /// @brief Настройки
+    struct Settings {
+        static constexpr u32 flush_delay_default{2000};
+
+        /// @brief Версия раскладки. При несовпадении сохранённые данные игнорируются
+        u16 version{0};
+
+        /// @brief Пауза после последнего изменения перед записью (мс)
+        u32 flush_delay_ms{flush_delay_default};
+    };
+
+    Settings settings{};
+
+private:
+    /// @brief Запись раскладки
+    struct Entry {
+
+        /// @brief Сохраняемое значение
+        u8 *data;
+
+        /// @brief Смещение записи в хранилище
+        u16 offset;
+
+        /// @brief Размер значения
+        u8 size;
+
+        /// @brief Запись требует сохранения
+        bool dirty;
+
+        /// @brief Последнее сохранённое значение
+        u8 shadow[value_size_max];
+    };
+
+    /// @brief Заголовок раскладки
+    struct Header {
+        u16 magic;
+        u16 version;
+        u16 size;
+    };
+
+    static constexpr u16 magic{0x4B46};
+
+    /// @brief Хранилище
+    Storage &storage;
+
+    /// @brief Записи раскладки
+    array<Entry, N> entries{};
+
+    /// @brief Кол-во записей
+    usize entries_total{0};
+
+    /// @brief Смещение следующей записи
+    u16 layout_size{sizeof(Header)};
+
+    /// @brief Время последнего изменения (мс)
+    u32 last_change_ms{0};
+
+    /// @brief Заголовок требует записи
+    bool header_dirty{true};
+
+    /// @brief Есть записи, требующие сохранения
+    bool pending{false};
+
+public:
+    explicit Persistence(Storage &storage) :
+        storage{storage} {}
+
+    /// @brief Зарегистрировать сохраняемое значение
+    /// @details Порядок регистрации определяет раскладку. Изменение порядка или состава требует смены версии
+    /// @param value Сохраняемое значение
+    /// @returns false - Превышено кол-во записей
+    template<typename T> bool bind(T &value) {
+        static_assert(kf::is_trivially_copyable<T>::value, "T must be trivially copyable");
+        static_assert(sizeof(T) <= value_size_max, "T is too large");
+
+        if (entries_total >= N) {
+            return false;
+        }
+
+        Entry &entry = entries[entries_total];
+        entry.data = reinterpret_cast<u8 *>(&value);
+        entry.offset = layout_size;
+        entry.size = sizeof(T);
+        entry.dirty = true;
+        copy(entry.shadow, entry.data, entry.size);
+
+        entries_total += 1;
+        layout_size += sizeof(T) + 1;
+        header_dirty = true;
+        pending = true;
+        return true;
+    }
+
+    /// @brief Загрузить значения из хранилища
+    /// @details Вызывается после регистрации всех значений.
+    /// Повреждённые записи и записи несовпадающей раскладки сохраняют текущие значения и будут перезаписаны
+    /// @returns true - Все значения загружены
+    bool load() {
+        Header header{};
+
+        if (not storage.read(0, reinterpret_cast<u8 *>(&header), sizeof(header))) {
+            return false;
+        }
+
+        if (header.magic != magic or header.version != settings.version or header.size != layout_size) {
+            return false;
+        }
+
+        header_dirty = false;
+        pending = false;
+
+        bool loaded{true};
+
+        for (usize i = 0; i < entries_total; i += 1) {
+            Entry &entry = entries[i];
+
+            u8 record[value_size_max + 1];
+
+            if (storage.read(entry.offset, record, entry.size + 1) and record[entry.size] == checksum(record, entry.size)) {
+                copy(entry.data, record, entry.size);
+                copy(entry.shadow, record, entry.size);
+                entry.dirty = false;
+            } else {
+                entry.dirty = true;
+                pending = true;
+                loaded = false;
+            }
+        }
+
+        return loaded;
+    }
+
+    /// @brief Отследить изменения и записать их после паузы
+    /// @details Вызывается периодически вне обработки UI
+    /// @param now_ms Текущее время (мс)
+    void poll(u32 now_ms) {
+        for (usize i = 0; i < entries_total; i += 1) {
+            Entry &entry = entries[i];
+
+            if (not equal(entry.data, entry.shadow, entry.size)) {
+                copy(entry.shadow, entry.data, entry.size);
+                entry.dirty = true;
+                pending = true;
+                last_change_ms = now_ms;
+            }
+        }
+
+        if (pending and now_ms - last_change_ms >= settings.flush_delay_ms) {
+            (void) flush();
+        }
+    }
+
+    /// @brief Немедленно записать изменившиеся записи
+    /// @returns true - Все записи сохранены
+    bool flush() {
+        if (not pending) {
+            return true;
+        }
+
+        if (header_dirty) {
+            const Header header{magic, settings.version, layout_size};
+
+            if (not storage.write(0, reinterpret_cast<const u8 *>(&header), sizeof(header))) {
+                return false;
+            }
+        }
+
+        bool written{true};
+
+        for (usize i = 0; i < entries_total; i += 1) {
+            Entry &entry = entries[i];
+
+            if (not entry.dirty) {
+                continue;
+            }
+
+            u8 record[value_size_max + 1];
+            copy(record, entry.shadow, entry.size);
+            record[entry.size] = checksum(record, entry.size);
+
+            if (storage.write(entry.offset, record, entry.size + 1)) {
+                entry.dirty = false;
+            } else {
+                written = false;
+            }
+        }
+
+        if (not storage.commit()) {
+            return false;
+        }
+
+        header_dirty = false;
+        pending = not written;
+        return written;
+    }
+
+    /// @brief Есть несохранённые изменения
+    kf_nodiscard bool dirty() const { return pending; }
+
+    /// @brief Размер раскладки в хранилище (байт)
+    kf_nodiscard usize size() const { return layout_size; }
+
+private:
+    static void copy(u8 *destination, const u8 *source, usize size) {
+        for (usize i = 0; i < size; i += 1) {
+            destination[i] = source[i];
+        }
+    }
+
+    kf_nodiscard static bool equal(const u8 *a, const u8 *b, usize size) {
+        for (usize i = 0; i < size; i += 1) {
+            if (a[i] != b[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    kf_nodiscard static u8 checksum(const u8 *data, usize size) {
+        u8 result{0x5A};
+
+        for (usize i = 0; i < size; i += 1) {
+            result = static_cast<u8>((result << 1) | (result >> 7)) ^ data[i];
+        }
+
+        return result;
+    }
+};
+
+}// namespace ui
+}// namespace kf
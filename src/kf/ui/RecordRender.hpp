@@ -0,0 +1,353 @@
+#pragma once
+
+#include <kf/aliases.hpp>
+#include <kf/attributes.hpp>
+#include <kf/fn.hpp>
+#include <kf/slice.hpp>
+
+#include "kf/ui/Format.hpp"
+#include "kf/ui/Render.hpp"
+
+namespace kf {
+namespace ui {
+
+/// @brief Система рендера, записывающая кадр в компактный список команд
+/// @details Страница отрисовывается один раз, после чего список воспроизводится в любое количество систем рендера.
+/// Кадр записывается поверх предыдущего с побайтовым сравнением, что позволяет без дополнительной памяти узнать, изменился ли кадр.
+struct RecordRender : Render<RecordRender> {
+    friend struct Render<RecordRender>;
+
+    /// @brief Единица измерения текстового интерфейса в глифах
+    using GlyphUnit = u8;
+
+    /// @brief Настройки рендера
+    struct Settings {
+        using RecordHandler = kf::fn<void(const RecordRender &)>;
+
+        static constexpr auto rows_default{4};
+
+        /// @brief Обработчик завершения записи кадра
+        RecordHandler on_record_finish{nullptr};
+
+        /// @brief Буфер списка команд
+        kf::slice<u8> buffer{};
+
+        /// @brief Кол-во строк (Должно соответствовать наименьшему из приёмников)
+        GlyphUnit rows_total{rows_default};
+
+        /// @brief Кол-во столбцов графика (Должно соответствовать наименьшему из приёмников). 0 - графики не записываются
+        GlyphUnit plot_width{0};
+    };
+
+    Settings settings{};
+
+private:
+    /// @brief Команда списка отображения
+    enum class Command : u8 {
+        Title,
+        String,
+        Integer,
+        Real,
+        Decimal,
+        PlotColumn,
+        Arrow,
+        Colon,
+        ContrastBegin,
+        ContrastEnd,
+        BlockBegin,
+        BlockEnd,
+        VariableBegin,
+        VariableEnd,
+        WidgetBegin,
+        WidgetEnd,
+    };
+
+    usize buffer_cursor{0};
+    usize command_start{0};
+    usize frame_size{0};
+    GlyphUnit cursor_row{0};
+    bool frame_changed{true};
+    bool frame_overflowed{false};
+
+public:
+    /// @brief Последний записанный кадр отличается от предыдущего
+    kf_nodiscard bool changed() const { return frame_changed; }
+
+    /// @brief Последний кадр не поместился в буфер и был усечён
+    kf_nodiscard bool overflowed() const { return frame_overflowed; }
+
+    /// @brief Размер списка команд последнего кадра в байтах
+    kf_nodiscard usize size() const { return frame_size; }
+
+    /// @brief Воспроизвести записанный кадр
+    /// @param sink Система рендера-приёмник
+    template<typename Sink> void replay(Render<Sink> &sink) const {
+        const u8 *data = settings.buffer.data();
+
+        sink.prepare();
+
+        usize offset{0};
+        while (offset < frame_size) {
+            const auto command = static_cast<Command>(data[offset]);
+            offset += 1;
+
+            switch (command) {
+                case Command::Title: {
+                    const auto str = reinterpret_cast<const char *>(data + offset);
+                    sink.title(str);
+                    offset += length(str) + 1;
+                    break;
+                }
+                case Command::String: {
+                    const auto str = reinterpret_cast<const char *>(data + offset);
+                    sink.string(str);
+                    offset += length(str) + 1;
+                    break;
+                }
+                case Command::Integer: {
+                    sink.number(take<i32>(data, offset));
+                    break;
+                }
+                case Command::Real: {
+                    const auto real = take<f64>(data, offset);
+                    sink.number(real, take<u8>(data, offset));
+                    break;
+                }
+                case Command::Decimal: {
+                    const auto scaled = take<i32>(data, offset);
+                    sink.decimal(scaled, take<u8>(data, offset));
+                    break;
+                }
+                case Command::PlotColumn: {
+                    sink.plotColumn(take<u8>(data, offset));
+                    break;
+                }
+                case Command::Arrow: sink.arrow(); break;
+                case Command::Colon: sink.colon(); break;
+                case Command::ContrastBegin: sink.contrastBegin(); break;
+                case Command::ContrastEnd: sink.contrastEnd(); break;
+                case Command::BlockBegin: sink.blockBegin(); break;
+                case Command::BlockEnd: sink.blockEnd(); break;
+                case Command::VariableBegin: sink.variableBegin(); break;
+                case Command::VariableEnd: sink.variableEnd(); break;
+                case Command::WidgetBegin: {
+                    sink.widgetBegin(take<usize>(data, offset));
+                    break;
+                }
+                case Command::WidgetEnd: sink.widgetEnd(); break;
+            }
+        }
+
+        sink.finish();
+    }
+
+    /// @brief Воспроизвести записанный кадр в несколько систем рендера
+    template<typename Sink, typename... Sinks> void replay(Render<Sink> &sink, Render<Sinks> &...sinks) const {
+        replay(sink);
+        replay(sinks...);
+    }
+
+private:
+    kf_nodiscard usize widgetsAvailableImpl() const {
+        return settings.rows_total - cursor_row;
+    }
+
+    kf_nodiscard usize cursorRowImpl() const {
+        return cursor_row;
+    }
+
+    void prepareImpl() {
+        buffer_cursor = 0;
+        command_start = 0;
+        cursor_row = 0;
+        frame_changed = false;
+        frame_overflowed = false;
+    }
+
+    void finishImpl() {
+        if (buffer_cursor != frame_size) {
+            frame_changed = true;
+        }
+
+        frame_size = buffer_cursor;
+
+        if (settings.on_record_finish) {
+            settings.on_record_finish(*this);
+        }
+    }
+
+    void titleImpl(const char *title) {
+        begin(Command::Title);
+        putString(title);
+        end();
+        cursor_row += 1;
+    }
+
+    void stringImpl(const char *str) {
+        begin(Command::String);
+        putString(str);
+        end();
+    }
+
+    void flashTitleImpl(const char *title) {
+        begin(Command::Title);
+        putFlashString(title);
+        end();
+        cursor_row += 1;
+    }
+
+    void flashStringImpl(const char *str) {
+        begin(Command::String);
+        putFlashString(str);
+        end();
+    }
+
+    void numberImpl(i32 integer) {
+        begin(Command::Integer);
+        put(integer);
+        end();
+    }
+
+    void numberImpl(f64 real, u8 rounding) {
+        begin(Command::Real);
+        put(real);
+        put(rounding);
+        end();
+    }
+
+    void decimalImpl(i32 scaled, u8 digits) {
+        begin(Command::Decimal);
+        put(scaled);
+        put(digits);
+        end();
+    }
+
+    kf_nodiscard usize plotWidthImpl() const { return settings.plot_width; }
+
+    void plotColumnImpl(u8 level) {
+        begin(Command::PlotColumn);
+        put(level);
+        end();
+    }
+
+    void arrowImpl() { record(Command::Arrow); }
+
+    void colonImpl() { record(Command::Colon); }
+
+    void contrastBeginImpl() { record(Command::ContrastBegin); }
+
+    void contrastEndImpl() { record(Command::ContrastEnd); }
+
+    void blockBeginImpl() { record(Command::BlockBegin); }
+
+    void blockEndImpl() { record(Command::BlockEnd); }
+
+    void variableBeginImpl() { record(Command::VariableBegin); }
+
+    void variableEndImpl() { record(Command::VariableEnd); }
+
+    void widgetBeginImpl(usize index) {
+        begin(Command::WidgetBegin);
+        put(index);
+        end();
+    }
+
+    void widgetEndImpl() {
+        record(Command::WidgetEnd);
+        cursor_row += 1;
+    }
+
+    // help methods...
+
+    /// @brief Записать команду без аргументов
+    void record(Command command) {
+        begin(command);
+        end();
+    }
+
+    /// @brief Начать запись команды
+    void begin(Command command) {
+        command_start = buffer_cursor;
+        putByte(static_cast<u8>(command));
+    }
+
+    /// @brief Завершить запись команды
+    /// @details Не поместившаяся команда отбрасывается целиком, чтобы список оставался корректным
+    void end() {
+        if (frame_overflowed) {
+            buffer_cursor = command_start;
+        }
+    }
+
+    void putString(const char *str) {
+        if (nullptr == str) {
+            str = "nullptr";
+        }
+
+        while (*str != '\x00') {
+            putByte(static_cast<u8>(*str));
+            str += 1;
+        }
+
+        putByte('\0');
+    }
+
+    void putFlashString(const char *str) {
+        formatFlashString(str, [this](char c) { putByte(static_cast<u8>(c)); });
+        putByte('\0');
+    }
+
+    template<typename T> void put(const T &value) {
+        const auto bytes = reinterpret_cast<const u8 *>(&value);
+
+        for (usize i = 0; i < sizeof(T); i += 1) {
+            putByte(bytes[i]);
+        }
+    }
+
+    void putByte(u8 byte) {
+        if (frame_overflowed) {
+            return;
+        }
+
+        if (buffer_cursor >= settings.buffer.size()) {
+            frame_overflowed = true;
+            frame_changed = true;
+            return;
+        }
+
+        u8 &slot = settings.buffer.data()[buffer_cursor];
+
+        if (slot != byte) {
+            slot = byte;
+            frame_changed = true;
+        }
+
+        buffer_cursor += 1;
+    }
+
+    template<typename T> static T take(const u8 *data, usize &offset) {
+        T value;
+        auto bytes = reinterpret_cast<u8 *>(&value);
+
+        for (usize i = 0; i < sizeof(T); i += 1) {
+            bytes[i] = data[offset + i];
+        }
+
+        offset += sizeof(T);
+        return value;
+    }
+
+    static usize length(const char *str) {
+        usize result{0};
+
+        while (str[result] != '\x00') {
+            result += 1;
+        }
+
+        return result;
+    }
+};
+
+}// namespace ui
+}// namespace kf
@@ -3,6 +3,9 @@
 #include <kf/aliases.hpp>
 #include <kf/attributes.hpp>
 
+#include "kf/ui/Fixed.hpp"
+#include "kf/ui/Text.hpp"
+
 namespace kf {
 
 /// @brief отдельное пространство имён для внешних компонентов UI
@@ -29,13 +32,51 @@ template<typename Impl> struct Render {
     /// @brief Количество виджетов, которые ещё возможно отобразить
     kf_nodiscard usize widgetsAvailable() { return impl().widgetsAvailableImpl(); }
 
+    /// @brief Значение <code>cursorRow</code>, если строка экрана неизвестна
+    static constexpr usize row_unknown{static_cast<usize>(-1)};
+
+    /// @brief Строка экрана, с которой продолжится вывод
+    /// @details Используется для определения виджета под указателем (<code>Event::PointerTap</code>)
+    kf_nodiscard usize cursorRow() { return impl().cursorRowImpl(); }
+
+    // Частичная перерисовка
+
+    /// @brief Поддерживается перерисовка отдельных строк виджетов
+    kf_nodiscard bool rowsRedrawSupported() { return impl().rowsRedrawSupportedImpl(); }
+
+    /// @brief Начало перерисовки строк
+    void rowsBegin() { impl().rowsBeginImpl(); }
+
+    /// @brief Завершение перерисовки строк
+    void rowsEnd() { impl().rowsEndImpl(); }
+
+    /// @brief Начало перерисовки строки виджета
+    /// @param row Строка в окне виджетов (0 - первый отображаемый виджет)
+    /// @param index Индекс виджета на странице
+    void rowBegin(usize row, usize index) { impl().rowBeginImpl(row, index); }
+
+    /// @brief Завершение перерисовки строки виджета
+    void rowEnd() { impl().rowEndImpl(); }
+
     // Значения
 
     /// @brief Заголовок страницы
-    void title(const char *title) { impl().titleImpl(title); }
+    void title(const Text &title) {
+        if (title.isFlash()) {
+            impl().flashTitleImpl(title.data());
+        } else {
+            impl().titleImpl(title.data());
+        }
+    }
 
     /// @brief Отобразить строку
-    void string(const char *str) { impl().stringImpl(str); }
+    void string(const Text &str) {
+        if (str.isFlash()) {
+            impl().flashStringImpl(str.data());
+        } else {
+            impl().stringImpl(str.data());
+        }
+    }
 
     /// @brief Отобразить целое число
     void number(i32 integer) { impl().numberImpl(integer); }
@@ -43,6 +84,27 @@ template<typename Impl> struct Render {
     /// @brief Отобразить вещественное число
     void number(f64 real, u8 rounding) { impl().numberImpl(real, rounding); }
 
+    /// @brief Отобразить число с фиксированной точкой
+    template<u8 D, typename I> void number(const Fixed<D, I> &fixed) { decimal(static_cast<i32>(fixed.raw()), D); }
+
+    /// @brief Отобразить десятичное число с фиксированной точкой
+    /// @param scaled Число, умноженное на 10^digits
+    /// @param digits Кол-во знаков после запятой
+    void decimal(i32 scaled, u8 digits) { impl().decimalImpl(scaled, digits); }
+
+    // График
+
+    /// @brief Кол-во уровней столбца графика
+    static constexpr u8 plot_levels{8};
+
+    /// @brief Кол-во столбцов графика, которые ещё возможно отобразить в строке
+    /// @details 0 - графики не поддерживаются
+    kf_nodiscard usize plotWidth() { return impl().plotWidthImpl(); }
+
+    /// @brief Отобразить столбец графика
+    /// @param level Высота столбца (0..plot_levels-1)
+    void plotColumn(u8 level) { impl().plotColumnImpl(level); }
+
     // Оформление
 
     /// @brief Отобразить стрелку от края к виджету
@@ -70,7 +132,104 @@ template<typename Impl> struct Render {
     void variableEnd() { impl().variableEndImpl(); }
 
 private:
+    /// @brief Размер части строки из памяти программ, копируемой в ОЗУ реализацией по умолчанию
+    static constexpr usize flash_chunk_size{16};
+
+    /// @brief Наибольшая длина заголовка из памяти программ для реализации по умолчанию
+    static constexpr usize flash_title_length_max{32};
+
     inline Impl &impl() { return *static_cast<Impl *>(this); }
+
+    // Реализация по умолчанию: строка из памяти программ копируется в ОЗУ частями
+
+    void flashStringImpl(const char *str) {
+        if (nullptr == str) {
+            impl().stringImpl(str);
+            return;
+        }
+
+        char chunk[flash_chunk_size + 1];
+        usize length{0};
+
+        while (true) {
+            const char c = flashRead(str);
+
+            if (c == '\x00' or length == flash_chunk_size) {
+                chunk[length] = '\x00';
+
+                if (length > 0) {
+                    impl().stringImpl(chunk);
+                    length = 0;
+                }
+
+                if (c == '\x00') {
+                    return;
+                }
+            }
+
+            chunk[length] = c;
+            length += 1;
+            str += 1;
+        }
+    }
+
+    void flashTitleImpl(const char *title) {
+        if (nullptr == title) {
+            impl().titleImpl(title);
+            return;
+        }
+
+        char buffer[flash_title_length_max + 1];
+        usize length{0};
+
+        while (length < flash_title_length_max) {
+            const char c = flashRead(title + length);
+
+            if (c == '\x00') {
+                break;
+            }
+
+            buffer[length] = c;
+            length += 1;
+        }
+
+        buffer[length] = '\x00';
+        impl().titleImpl(buffer);
+    }
+
+    // Реализация по умолчанию: десятичное число отображается как вещественное
+
+    void decimalImpl(i32 scaled, u8 digits) {
+        f64 divider{1};
+
+        for (u8 i = 0; i < digits; i += 1) {
+            divider *= 10;
+        }
+
+        impl().numberImpl(static_cast<f64>(scaled) / divider, digits);
+    }
+
+    // Реализация по умолчанию: графики не поддерживаются
+
+    kf_nodiscard usize plotWidthImpl() const { return 0; }
+
+    void plotColumnImpl(u8) {}
+
+    // Реализация по умолчанию: строка экрана неизвестна, касания не обрабатываются
+
+    kf_nodiscard usize cursorRowImpl() const { return row_unknown; }
+
+    // Реализация по умолчанию: частичная перерисовка не поддерживается
+
+    kf_nodiscard bool rowsRedrawSupportedImpl() const { return false; }
+
+    void rowsBeginImpl() {}
+
+    void rowsEndImpl() {}
+
+    void rowBeginImpl(usize, usize) {}
+
+    void rowEndImpl() {}
 };
 
 }// namespace ui
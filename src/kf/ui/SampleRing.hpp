@@ -0,0 +1,140 @@
+#pragma once
+
+#include <atomic>
+
+#include <kf/aliases.hpp>
+#include <kf/attributes.hpp>
+#include <kf/type_traits.hpp>
+
+namespace kf {
+namespace ui {
+
+/// @brief Кольцо отсчётов фиксированного размера с наименьшим и наибольшим значением
+/// @details Отсчёты добавляются одной задачей (например, задачей управления) без блокировок и выделения памяти,
+/// читаются задачей UI. При переполнении вытесняется самый старый отсчёт.
+/// Наименьшее и наибольшее значения поддерживаются монотонными очередями: добавление - O(1) в среднем
+/// @tparam T Тип отсчёта. Не более 4 байт: на 32-битных ядрах <code>std::atomic</code> большего размера не lock-free
+/// @tparam N Кол-во отсчётов
+template<typename T, usize N> struct SampleRing {
+    static_assert(kf::is_arithmetic<T>::value, "T must be arithmetic");
+    static_assert(sizeof(T) <= 4, "sizeof(T) <= 4");
+    static_assert(N >= 1, "N >= 1");
+    static_assert(N <= 0xFFFF, "N <= 0xFFFF");
+
+private:
+    /// @brief Монотонная очередь ячеек кольца
+    /// @details Значения ячеек от начала к концу очереди упорядочены, начало - экстремум окна
+    struct Queue {
+        u16 slots[N];
+        u16 first{0};
+        u16 size{0};
+
+        kf_nodiscard u16 front() const { return slots[first]; }
+
+        kf_nodiscard u16 back() const { return slots[(first + size - 1) % N]; }
+
+        void popFront() {
+            first = static_cast<u16>((first + 1) % N);
+            size -= 1;
+        }
+
+        void popBack() { size -= 1; }
+
+        void pushBack(u16 slot) {
+            slots[(first + size) % N] = slot;
+            size += 1;
+        }
+    };
+
+    /// @brief Отсчёты
+    std::atomic<T> samples[N];
+
+    /// @brief Кол-во добавленных отсчётов
+    std::atomic<u32> head{0};
+
+    /// @brief Наименьшее значение окна
+    std::atomic<T> low_value{0};
+
+    /// @brief Наибольшее значение окна
+    std::atomic<T> high_value{0};
+
+    /// @brief Добавлены отсчёты с момента последней проверки
+    std::atomic<bool> changed{false};
+
+    /// @brief Очередь наименьшего значения (Используется только добавляющей задачей)
+    Queue min_queue{};
+
+    /// @brief Очередь наибольшего значения (Используется только добавляющей задачей)
+    Queue max_queue{};
+
+public:
+    /// @brief Тип отсчёта
+    using Value = T;
+
+    /// @brief Добавить отсчёт
+    /// @details Вызывается только из одной задачи
+    void push(T value) {
+        const u32 ticket = head.load(std::memory_order_relaxed);
+        const auto slot = static_cast<u16>(ticket % N);
+
+        // Вытесняемый отсчёт покидает окно
+        if (ticket >= N) {
+            if (min_queue.size > 0 and min_queue.front() == slot) { min_queue.popFront(); }
+            if (max_queue.size > 0 and max_queue.front() == slot) { max_queue.popFront(); }
+        }
+
+        while (min_queue.size > 0 and sample(min_queue.back()) >= value) { min_queue.popBack(); }
+        while (max_queue.size > 0 and sample(max_queue.back()) <= value) { max_queue.popBack(); }
+
+        samples[slot].store(value, std::memory_order_relaxed);
+        min_queue.pushBack(slot);
+        max_queue.pushBack(slot);
+
+        low_value.store(sample(min_queue.front()), std::memory_order_relaxed);
+        high_value.store(sample(max_queue.front()), std::memory_order_relaxed);
+
+        head.store(ticket + 1, std::memory_order_release);
+        changed.store(true, std::memory_order_release);
+    }
+
+    /// @brief Кол-во добавленных отсчётов за всё время
+    /// @details Номер следующего отсчёта: хранятся отсчёты с номерами от <code>total() - count()</code>
+    kf_nodiscard u32 total() const {
+        return head.load(std::memory_order_acquire);
+    }
+
+    /// @brief Кол-во хранимых отсчётов
+    kf_nodiscard usize count() const {
+        const auto pushed = total();
+        return pushed < N ? pushed : N;
+    }
+
+    /// @brief Отсчёт по номеру
+    /// @details Отсчёт, вытесненный во время чтения, заменяется более новым
+    kf_nodiscard T at(u32 ticket) const {
+        return sample(static_cast<u16>(ticket % N));
+    }
+
+    /// @brief Наименьшее значение хранимых отсчётов
+    kf_nodiscard T lowest() const {
+        return low_value.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Наибольшее значение хранимых отсчётов
+    kf_nodiscard T highest() const {
+        return high_value.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Проверить и сбросить признак новых отсчётов
+    kf_nodiscard bool takeChanged() {
+        return changed.exchange(false, std::memory_order_acq_rel);
+    }
+
+private:
+    kf_nodiscard T sample(u16 slot) const {
+        return samples[slot].load(std::memory_order_relaxed);
+    }
+};
+
+}// namespace ui
+}// namespace kf
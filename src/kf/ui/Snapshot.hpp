@@ -0,0 +1,45 @@
+#pragma once
+
+#include <kf/aliases.hpp>
+#include <kf/attributes.hpp>
+
+namespace kf {
+namespace ui {
+
+/// @brief Записать значение в снимок состояния
+/// @param out Позиция записи
+/// @param value Значение
+template<typename T> void snapshotWrite(u8 *out, const T &value) {
+    const auto bytes = reinterpret_cast<const u8 *>(&value);
+
+    for (usize i = 0; i < sizeof(T); i += 1) {
+        out[i] = bytes[i];
+    }
+}
+
+/// @brief Прочитать значение из снимка состояния
+/// @param in Позиция чтения
+template<typename T> T snapshotRead(const u8 *in) {
+    T value;
+    const auto bytes = reinterpret_cast<u8 *>(&value);
+
+    for (usize i = 0; i < sizeof(T); i += 1) {
+        bytes[i] = in[i];
+    }
+
+    return value;
+}
+
+/// @brief Контрольная сумма снимка состояния
+kf_nodiscard inline u8 snapshotChecksum(const u8 *data, usize size) {
+    u8 result{0xA5};
+
+    for (usize i = 0; i < size; i += 1) {
+        result = static_cast<u8>((result << 1) | (result >> 7)) ^ data[i];
+    }
+
+    return result;
+}
+
+}// namespace ui
+}// namespace kf
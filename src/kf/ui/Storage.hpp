@@ -0,0 +1,32 @@
+#pragma once
+
+#include <kf/aliases.hpp>
+
+namespace kf {
+namespace ui {
+
+/// @brief Энергонезависимое хранилище
+/// @details Реализуется поверх NVS, EEPROM, Flash или файла
+struct Storage {
+
+    /// @brief Прочитать данные
+    /// @param offset Смещение от начала хранилища
+    /// @param data Буфер назначения
+    /// @param size Кол-во байт
+    /// @returns true - Данные прочитаны
+    virtual bool read(usize offset, u8 *data, usize size) = 0;
+
+    /// @brief Записать данные
+    /// @param offset Смещение от начала хранилища
+    /// @param data Записываемые байты
+    /// @param size Кол-во байт
+    /// @returns true - Данные записаны
+    virtual bool write(usize offset, const u8 *data, usize size) = 0;
+
+    /// @brief Зафиксировать записанные данные
+    /// @returns true - Данные зафиксированы
+    virtual bool commit() { return true; }
+};
+
+}// namespace ui
+}// namespace kf
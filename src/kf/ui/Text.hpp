@@ -0,0 +1,91 @@
+#pragma once
+
+#include <kf/aliases.hpp>
+#include <kf/attributes.hpp>
+
+#if defined(__AVR__)
+#include <avr/pgmspace.h>
+#endif
+
+#if defined(ARDUINO)
+// Тип строк макроса F() из Arduino
+class __FlashStringHelper;
+#endif
+
+namespace kf {
+namespace ui {
+
+/// @brief Прочитать символ строки, размещённой в памяти программ
+/// @details На AVR память программ имеет отдельное адресное пространство, на остальных платформах отображена в общее
+inline char flashRead(const char *str) {
+#if defined(__AVR__)
+    return static_cast<char>(pgm_read_byte(str));
+#else
+    return *str;
+#endif
+}
+
+/// @brief Ссылка на неизменяемую строку в ОЗУ или в памяти программ
+/// @details Метки, заголовки и наименования элементов хранятся как <code>Text</code>:
+/// строки из памяти программ (<code>F("...")</code>, <code>PROGMEM</code>) не копируются в ОЗУ,
+/// а читаются системой рендера посимвольно при отрисовке
+struct Text {
+
+private:
+    /// @brief Строка
+    const char *str;
+
+#if defined(__AVR__)
+    /// @brief Строка размещена в памяти программ
+    bool in_flash;
+
+    constexpr Text(const char *str, bool in_flash) :
+        str{str}, in_flash{in_flash} {}
+#endif
+
+public:
+    /// @brief Строка в ОЗУ
+    constexpr Text(const char *str) :// NOLINT(*-explicit-constructor)
+#if defined(__AVR__)
+        str{str}, in_flash{false} {}
+#else
+        str{str} {}
+#endif
+
+#if defined(ARDUINO)
+    /// @brief Строка макроса <code>F("...")</code>
+    Text(const __FlashStringHelper *str) :// NOLINT(*-explicit-constructor)
+        Text{flash(reinterpret_cast<const char *>(str))} {}
+#endif
+
+    /// @brief Строка в памяти программ (<code>PROGMEM</code>)
+    static constexpr Text flash(const char *str) {
+#if defined(__AVR__)
+        return Text{str, true};
+#else
+        return Text{str};
+#endif
+    }
+
+    /// @brief Указатель на строку
+    /// @details Для строк из памяти программ - адрес в памяти программ (См. <code>isFlash</code>)
+    kf_nodiscard constexpr const char *data() const { return str; }
+
+    /// @brief Строка размещена в отдельном адресном пространстве памяти программ
+    /// @details Всегда false на платформах с общим адресным пространством
+    kf_nodiscard constexpr bool isFlash() const {
+#if defined(__AVR__)
+        return in_flash;
+#else
+        return false;
+#endif
+    }
+
+    /// @brief Символ строки
+    kf_nodiscard char operator[](usize index) const {
+        return isFlash() ? flashRead(str + index) : str[index];
+    }
+};
+
+}// namespace ui
+}// namespace kf
@@ -1,14 +1,12 @@
 #pragma once
 
-// for avr capability
-#include <math.h>// NOLINT(*-deprecated-headers)
-
 #include <kf/aliases.hpp>
 #include <kf/array.hpp>
 #include <kf/attributes.hpp>
 #include <kf/fn.hpp>
 #include <kf/slice.hpp>
 
+#include "kf/ui/Format.hpp"
 #include "kf/ui/Render.hpp"
 
 namespace kf {
@@ -21,16 +19,38 @@ struct TextRender : Render<TextRender> {
     /// @brief Единица измерения текстового интерфейса в глифах
     using GlyphUnit = u8;
 
+    /// @brief Размер буфера, достаточный для любого кадра указанной геометрии
+    /// @details Строка содержит не более <code>cols</code> байт (включая маркер начала контраста),
+    /// закрывающий маркер контраста при переполнении строки и перевод строки.
+    /// Последний перевод строки заменяется завершающим нулём.
+    /// @param rows Кол-во строк
+    /// @param cols Максимальная длина строки
+    static constexpr usize frameSize(GlyphUnit rows, GlyphUnit cols) {
+        return static_cast<usize>(rows) * (static_cast<usize>(cols) + 2);
+    }
+
+    /// @brief Статически выделенный буфер кадра точного размера
+    /// @tparam Rows Кол-во строк
+    /// @tparam Cols Максимальная длина строки
+    template<GlyphUnit Rows, GlyphUnit Cols> struct Buffer;
+
     /// @brief Настройки рендера
     struct Settings {
         using RenderHandler = kf::fn<void(const kf::slice<const u8> &)>;
 
+        /// @brief Обработчик перерисовки строки (Номер строки экрана, текст строки)
+        using RowHandler = kf::fn<void(GlyphUnit, const kf::slice<const u8> &)>;
+
         static constexpr auto rows_default{4};
         static constexpr auto cols_default{16};
 
         /// @brief Обработчик отрисовки
         RenderHandler on_render_finish{nullptr};
 
+        /// @brief Обработчик перерисовки отдельной строки
+        /// @details Если задан, перемещение курсора в пределах окна перерисовывает только две строки
+        RowHandler on_row_redraw{nullptr};
+
         /// @brief буфер вывода
         kf::slice<u8> buffer{};
 
@@ -39,6 +59,14 @@ struct TextRender : Render<TextRender> {
 
         /// @brief Максимальная длина строки
         GlyphUnit row_max_length{cols_default};
+
+        /// @brief Установить буфер кадра вместе с его геометрией
+        /// @details Размер буфера всегда соответствует геометрии, усечение кадра исключено
+        template<GlyphUnit Rows, GlyphUnit Cols> void bindBuffer(Buffer<Rows, Cols> &frame) {
+            buffer = {frame.data, sizeof(frame.data)};
+            rows_total = Rows;
+            row_max_length = Cols;
+        }
     };
 
     Settings settings{};
@@ -46,12 +74,17 @@ struct TextRender : Render<TextRender> {
 private:
     usize buffer_cursor{0};
     GlyphUnit cursor_row{0}, cursor_col{0};
+    GlyphUnit redraw_row{0};
     bool contrast_mode{false};
 
     kf_nodiscard usize widgetsAvailableImpl() const {
         return settings.rows_total - cursor_row;
     }
 
+    kf_nodiscard usize cursorRowImpl() const {
+        return cursor_row;
+    }
+
     void prepareImpl() {
         buffer_cursor = 0;
     }
@@ -70,6 +103,39 @@ private:
         }
     }
 
+    kf_nodiscard bool rowsRedrawSupportedImpl() const {
+        return nullptr != settings.buffer.data() and static_cast<bool>(settings.on_row_redraw);
+    }
+
+    void rowsBeginImpl() {}
+
+    void rowsEndImpl() {
+        buffer_cursor = 0;
+        cursor_row = 0;
+        cursor_col = 0;
+    }
+
+    void rowBeginImpl(usize row, usize) {
+        // Первая строка экрана занята заголовком
+        redraw_row = static_cast<GlyphUnit>(row + 1);
+
+        buffer_cursor = 0;
+        cursor_row = redraw_row;
+        cursor_col = 0;
+        contrast_mode = false;
+    }
+
+    void rowEndImpl() {
+        (void) write('\n');
+
+        if (buffer_cursor == 0) {
+            return;
+        }
+
+        settings.buffer.data()[buffer_cursor - 1] = '\0';
+        settings.on_row_redraw(redraw_row, {settings.buffer.data(), buffer_cursor});
+    }
+
     void titleImpl(const char *title) {
         (void) print(title);
         (void) write('\n');
@@ -79,6 +145,15 @@ private:
         (void) print(str);
     }
 
+    void flashTitleImpl(const char *title) {
+        formatFlashString(title, [this](char c) { (void) write(c); });
+        (void) write('\n');
+    }
+
+    void flashStringImpl(const char *str) {
+        formatFlashString(str, [this](char c) { (void) write(c); });
+    }
+
     void numberImpl(i32 integer) {
         (void) print(integer);
     }
@@ -87,6 +162,20 @@ private:
         (void) print(real, rounding);
     }
 
+    void decimalImpl(i32 scaled, u8 digits) {
+        formatDecimal(scaled, digits, [this](char c) { (void) write(c); });
+    }
+
+    kf_nodiscard usize plotWidthImpl() const {
+        return cursor_col < settings.row_max_length ? settings.row_max_length - cursor_col : 0;
+    }
+
+    void plotColumnImpl(u8 level) {
+        // Символы возрастающей высоты
+        static constexpr char ramp[plot_levels + 1]{"_.:-=+*#"};
+        (void) write(ramp[level < plot_levels ? level : plot_levels - 1]);
+    }
+
     void arrowImpl() {
         (void) write('-');
         (void) write('>');
@@ -133,83 +222,20 @@ private:
     // help methods...
 
     kf_nodiscard usize print(const char *str) {
-        if (nullptr == str) {
-            str = "nullptr";
-        }
-
         usize written{0};
-
-        while (*str != '\x00') {
-            written += write(*str);
-            str += 1;
-        }
-
+        formatString(str, [this, &written](char c) { written += write(c); });
         return written;
     }
 
     kf_nodiscard usize print(i32 integer) {
-        if (integer == 0) {
-            return write('0');
-        }
-
         usize written{0};
-
-        if (integer < 0) {
-            integer = -integer;
-            written += write('-');
-        }
-
-        char digits_buffer[12];
-
-        auto digits_total{0};
-        while (integer > 0) {
-            const auto base = 10;
-
-            digits_buffer[digits_total] = static_cast<char>(integer % base + '0');
-            digits_total += 1;
-            integer /= base;
-        }
-
-        for (auto i = digits_total - 1; i >= 0; i -= 1) {
-            written += write(digits_buffer[i]);
-        }
-
+        formatInteger(integer, [this, &written](char c) { written += write(c); });
         return written;
     }
 
     kf_nodiscard usize print(f64 real, u8 rounding) {
-        if (isnan(real)) {
-            return print("nan");
-        }
-
-        if (isinf(real)) {
-            return print("inf");
-        }
-
         usize written{0};
-
-        if (real < 0) {
-            real = -real;
-            written += write('-');
-        }
-
-        written += print(i32(real));
-
-        if (rounding > 0) {
-            written += write('.');
-
-            auto fractional = real - i32(real);
-
-            for (auto i = 0; i < rounding; i += 1) {
-                const auto base = 10;
-
-                fractional *= base;
-                const auto digit = u8(fractional);
-                written += write('0' + digit);
-                fractional -= digit;
-            }
-        }
-
+        formatReal(real, rounding, [this, &written](char c) { written += write(c); });
         return written;
     }
 
@@ -242,5 +268,13 @@ private:
     }
 };
 
+template<TextRender::GlyphUnit Rows, TextRender::GlyphUnit Cols> struct TextRender::Buffer {
+    static_assert(Rows >= 1, "Rows >= 1");
+    static_assert(Cols >= 1, "Cols >= 1");
+
+    /// @brief Байты кадра
+    u8 data[frameSize(Rows, Cols)];
+};
+
 }// namespace ui
 }// namespace kf